@@ -0,0 +1,461 @@
+#include "framework.h"
+#include "Game/AnimationCompression.h"
+
+#include "Game/animation.h"
+#include "Specific/level.h"
+
+#include <chrono>
+#include <random>
+
+namespace TEN::Animation
+{
+	constexpr auto QUAT_COMPONENT_BITS	= 15;
+	constexpr auto QUAT_COMPONENT_MAX	= (1 << QUAT_COMPONENT_BITS) - 1;
+	constexpr auto QUAT_COMPONENT_RANGE = 1.0f / SQRT_2; // Components other than largest never exceed it.
+
+	constexpr auto TRACK_SHIFT_MAX = 3;
+
+	bool PackedQuaternion::operator ==(const PackedQuaternion& quat) const
+	{
+		return (Data[0] == quat.Data[0] && Data[1] == quat.Data[1] && Data[2] == quat.Data[2]);
+	}
+
+	PackedQuaternion PackQuaternion(const Quaternion& quat)
+	{
+		auto normalizedQuat = quat;
+		normalizedQuat.Normalize();
+
+		float components[4] = { normalizedQuat.x, normalizedQuat.y, normalizedQuat.z, normalizedQuat.w };
+
+		int largest = 0;
+		for (int i = 1; i < 4; i++)
+		{
+			if (abs(components[i]) > abs(components[largest]))
+				largest = i;
+		}
+
+		// q and -q are same rotation; flip so that dropped component is positive and can be restored.
+		float sign = (components[largest] < 0.0f) ? -1.0f : 1.0f;
+
+		uint64_t bits = (uint64_t)largest;
+		int shift = 2;
+		for (int i = 0; i < 4; i++)
+		{
+			if (i == largest)
+				continue;
+
+			float normalizedValue = ((components[i] * sign / QUAT_COMPONENT_RANGE) + 1.0f) * 0.5f;
+			auto quantizedValue = (uint64_t)std::clamp((int)round(normalizedValue * QUAT_COMPONENT_MAX), 0, QUAT_COMPONENT_MAX);
+
+			bits |= quantizedValue << shift;
+			shift += QUAT_COMPONENT_BITS;
+		}
+
+		auto packedQuat = PackedQuaternion{};
+		packedQuat.Data[0] = (uint16_t)bits;
+		packedQuat.Data[1] = (uint16_t)(bits >> 16);
+		packedQuat.Data[2] = (uint16_t)(bits >> 32);
+		return packedQuat;
+	}
+
+	Quaternion UnpackQuaternion(const PackedQuaternion& packedQuat)
+	{
+		uint64_t bits = (uint64_t)packedQuat.Data[0] | ((uint64_t)packedQuat.Data[1] << 16) | ((uint64_t)packedQuat.Data[2] << 32);
+
+		int largest = (int)(bits & 3);
+		int shift = 2;
+
+		float components[4] = {};
+		float sqrSum = 0.0f;
+		for (int i = 0; i < 4; i++)
+		{
+			if (i == largest)
+				continue;
+
+			float normalizedValue = (float)((bits >> shift) & QUAT_COMPONENT_MAX) / QUAT_COMPONENT_MAX;
+			components[i] = ((normalizedValue * 2.0f) - 1.0f) * QUAT_COMPONENT_RANGE;
+			sqrSum += SQUARE(components[i]);
+			shift += QUAT_COMPONENT_BITS;
+		}
+
+		components[largest] = sqrt(std::max(1.0f - sqrSum, 0.0f));
+		return Quaternion(components[0], components[1], components[2], components[3]);
+	}
+
+	static Quaternion DecodeTrack(const AnimTrack& track, const PackedQuaternion* keys, int frame)
+	{
+		if (track.IsConstant)
+			return UnpackQuaternion(keys[0]);
+
+		int key = frame >> track.Shift;
+		int frame0 = key << track.Shift;
+		if (frame0 == frame)
+			return UnpackQuaternion(keys[key]);
+
+		// Last key is always last frame, so final interval may be shorter than others.
+		int frame1 = std::min((key + 1) << track.Shift, track.FrameCount - 1);
+		float alpha = (float)(frame - frame0) / (float)(frame1 - frame0);
+
+		return Quaternion::Slerp(UnpackQuaternion(keys[key]), UnpackQuaternion(keys[key + 1]), alpha);
+	}
+
+	Quaternion GetTrackOrientation(const AnimTrack& track, int frame)
+	{
+		return DecodeTrack(track, &g_Level.BoneOrientations[track.KeyIndex], frame);
+	}
+
+	static float GetAngularError(const Quaternion& quat0, const Quaternion& quat1)
+	{
+		// Chord length instead of acos of dot product, which can't resolve angles this small.
+		float sign = (quat0.Dot(quat1) < 0.0f) ? -1.0f : 1.0f;
+		auto delta = Vector4(quat0.x - (quat1.x * sign), quat0.y - (quat1.y * sign), quat0.z - (quat1.z * sign), quat0.w - (quat1.w * sign));
+		return (4.0f * asin(std::min(delta.Length() / 2, 1.0f)));
+	}
+
+	static float GetTrackError(const AnimTrack& track, const std::vector<PackedQuaternion>& keys, const std::vector<Quaternion>& orientations)
+	{
+		float maxError = 0.0f;
+		for (int i = 0; i < orientations.size(); i++)
+			maxError = std::max(maxError, GetAngularError(DecodeTrack(track, keys.data(), i), orientations[i]));
+
+		return maxError;
+	}
+
+	static void BuildTrackKeys(const AnimTrack& track, const std::vector<PackedQuaternion>& packedOrientations, std::vector<PackedQuaternion>& keys)
+	{
+		keys.clear();
+
+		if (track.IsConstant)
+		{
+			keys.push_back(packedOrientations.front());
+			return;
+		}
+
+		int lastFrame = track.FrameCount - 1;
+		for (int frame = 0; frame < lastFrame; frame += (1 << track.Shift))
+			keys.push_back(packedOrientations[frame]);
+
+		keys.push_back(packedOrientations[lastFrame]);
+	}
+
+	// Picks cheapest track layout which stays within error bound. Quantization error is always accepted,
+	// so constant elimination is exact when maxError is 0.
+	static float CompressTrack(const std::vector<Quaternion>& orientations, float maxError, std::vector<PackedQuaternion>& packedOrientations,
+							   std::vector<PackedQuaternion>& keys, AnimTrack& track)
+	{
+		packedOrientations.resize(orientations.size());
+		for (int i = 0; i < orientations.size(); i++)
+			packedOrientations[i] = PackQuaternion(orientations[i]);
+
+		track.FrameCount = (short)orientations.size();
+		track.Shift = 0;
+		track.IsConstant = true;
+
+		bool isExactlyConstant = std::all_of(
+			packedOrientations.begin(), packedOrientations.end(),
+			[&](const PackedQuaternion& packedQuat) { return (packedQuat == packedOrientations.front()); });
+
+		BuildTrackKeys(track, packedOrientations, keys);
+		float error = GetTrackError(track, keys, orientations);
+		if (isExactlyConstant || error <= maxError)
+			return error;
+
+		track.IsConstant = false;
+
+		if (maxError > 0.0f)
+		{
+			for (int shift = TRACK_SHIFT_MAX; shift > 0; shift--)
+			{
+				if ((1 << shift) >= track.FrameCount)
+					continue;
+
+				track.Shift = shift;
+				BuildTrackKeys(track, packedOrientations, keys);
+				error = GetTrackError(track, keys, orientations);
+				if (error <= maxError)
+					return error;
+			}
+		}
+
+		track.Shift = 0;
+		BuildTrackKeys(track, packedOrientations, keys);
+		return GetTrackError(track, keys, orientations);
+	}
+
+	// Splits frames into runs belonging to single animation and stores every bone of run as separate track.
+	// Source orientations are expected in same per-frame layout as in level file. Error of any bone chain,
+	// quantization excluded, stays within maxError. With maxError of 0 every keyframe is kept.
+	void CompressAnimations(const std::vector<Quaternion>& orientations, const std::vector<int>& frameOrientationIndices, float maxError, bool logAnims)
+	{
+		auto& frames = g_Level.Frames;
+		int frameCount = (int)frames.size();
+
+		g_Level.AnimTracks.clear();
+		g_Level.BoneOrientations.clear();
+
+		// Run boundaries are animation starts. Map run start to animation for reporting.
+		auto runStarts = std::vector<std::pair<int, int>>{};
+		runStarts.reserve(g_Level.Anims.size() + 1);
+		for (int i = 0; i < g_Level.Anims.size(); i++)
+		{
+			int framePtr = g_Level.Anims[i].FramePtr;
+			if (framePtr >= 0 && framePtr < frameCount)
+				runStarts.push_back({ framePtr, i });
+		}
+
+		// Frames before first animation, if any, still form a run.
+		runStarts.push_back({ 0, NO_ANIM });
+
+		std::stable_sort(
+			runStarts.begin(), runStarts.end(),
+			[](const auto& run0, const auto& run1) { return (run0.first < run1.first); });
+
+		auto runOrientations = std::vector<Quaternion>{};
+		auto packedOrientations = std::vector<PackedQuaternion>{};
+		auto keys = std::vector<PackedQuaternion>{};
+
+		size_t totalSourceSize = 0;
+		size_t totalCompressedSize = 0;
+		float totalMaxError = 0.0f;
+
+		for (int run = 0; run < runStarts.size(); run++)
+		{
+			// Skip duplicate starts of animations sharing frames.
+			if (run > 0 && runStarts[run].first == runStarts[run - 1].first)
+				continue;
+
+			int runStart = runStarts[run].first;
+			int runEnd = frameCount;
+			for (int next = run + 1; next < runStarts.size(); next++)
+			{
+				if (runStarts[next].first != runStart)
+				{
+					runEnd = runStarts[next].first;
+					break;
+				}
+			}
+
+			int animIndex = runStarts[run].second;
+
+			// Runs are further split if bone count changes, as every frame of track needs same skeleton.
+			for (int start = runStart; start < runEnd;)
+			{
+				int boneCount = frames[start].BoneCount;
+				int end = start + 1;
+				while (end < runEnd && frames[end].BoneCount == boneCount && (end - start) < SHRT_MAX)
+					end++;
+
+				int trackIndex = (int)g_Level.AnimTracks.size();
+				for (int i = start; i < end; i++)
+				{
+					frames[i].TrackIndex = trackIndex;
+					frames[i].TrackFrame = i - start;
+				}
+
+				size_t sourceSize = sizeof(Quaternion) * boneCount * (end - start);
+				size_t compressedSize = sizeof(AnimTrack) * boneCount;
+				float runMaxError = 0.0f;
+
+				// Bone errors add up down hierarchy, so budget is split between bones to bound error of any chain.
+				float boneMaxError = (boneCount > 0) ? (maxError / boneCount) : 0.0f;
+
+				for (int bone = 0; bone < boneCount; bone++)
+				{
+					runOrientations.clear();
+					for (int i = start; i < end; i++)
+						runOrientations.push_back(orientations[frameOrientationIndices[i] + bone]);
+
+					auto track = AnimTrack{};
+					float error = CompressTrack(runOrientations, boneMaxError, packedOrientations, keys, track);
+
+					track.KeyIndex = (int)g_Level.BoneOrientations.size();
+					g_Level.BoneOrientations.insert(g_Level.BoneOrientations.end(), keys.begin(), keys.end());
+					g_Level.AnimTracks.push_back(track);
+
+					compressedSize += sizeof(PackedQuaternion) * keys.size();
+					runMaxError += error;
+				}
+
+				if (logAnims && boneCount > 0)
+				{
+					TENLog("Animation " + ((animIndex != NO_ANIM) ? std::to_string(animIndex) : std::string("-")) +
+						   ": frames " + std::to_string(end - start) +
+						   ", bones " + std::to_string(boneCount) +
+						   ", ratio " + std::to_string((float)sourceSize / (float)compressedSize) +
+						   ", max chain error " + std::to_string(runMaxError / RADIAN) + " deg.", LogLevel::Info);
+				}
+
+				totalSourceSize += sourceSize;
+				totalCompressedSize += compressedSize;
+				totalMaxError = std::max(totalMaxError, runMaxError);
+				start = end;
+			}
+		}
+
+		g_Level.AnimTracks.shrink_to_fit();
+		g_Level.BoneOrientations.shrink_to_fit();
+
+		if (totalCompressedSize > 0)
+		{
+			TENLog("Animation keyframes compressed from " + std::to_string(totalSourceSize / 1024) + " KB to " +
+				   std::to_string(totalCompressedSize / 1024) + " KB (ratio " + std::to_string((float)totalSourceSize / (float)totalCompressedSize) +
+				   ", max chain error " + std::to_string(totalMaxError / RADIAN) + " deg).", LogLevel::Info);
+		}
+	}
+
+	// Compresses random smooth animations of single bone chain losslessly and with given error bound.
+	// Checks that orientation error at end of chain stays within bound, and logs ratio and decode time per pose
+	// against interpolating uncompressed keyframes.
+	bool BenchmarkAnimationCompression(float maxError)
+	{
+		constexpr auto ANIM_COUNT	  = 64;
+		constexpr auto KEYFRAME_COUNT = 32;
+		constexpr auto BONE_COUNT	  = 15;
+		constexpr auto POSE_COUNT	  = 256;
+		constexpr auto FRAME_COUNT	  = 200;
+
+		// Fixed seed keeps report reproducible between runs.
+		auto generator = std::mt19937(KEYFRAME_COUNT);
+		auto getRandom = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(generator); };
+		auto getRandomQuat = [&](float maxAngle)
+		{
+			auto axis = Vector3(getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f)) + Vector3(0.0f, 0.01f, 0.0f);
+			axis.Normalize();
+			return Quaternion::CreateFromAxisAngle(axis, getRandom(-maxAngle, maxAngle));
+		};
+
+		// Source tracks, indexed by animation and bone. Bones swing smoothly about random axis, and some are static,
+		// as in real animations.
+		auto sourceTracks = std::vector<std::vector<Quaternion>>(ANIM_COUNT * BONE_COUNT);
+		for (int anim = 0; anim < ANIM_COUNT; anim++)
+		{
+			for (int bone = 0; bone < BONE_COUNT; bone++)
+			{
+				auto& track = sourceTracks[(anim * BONE_COUNT) + bone];
+
+				auto baseOrient = getRandomQuat(PI);
+				auto axis = Vector3(getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f)) + Vector3(0.0f, 0.01f, 0.0f);
+				axis.Normalize();
+
+				float amplitude = (getRandom(0.0f, 1.0f) < 0.3f) ? 0.0f : getRandom(1.0f, 30.0f) * RADIAN;
+				float frequency = getRandom(0.05f, 0.3f);
+				float phase = getRandom(0.0f, PI_MUL_2);
+
+				for (int frame = 0; frame < KEYFRAME_COUNT; frame++)
+				{
+					auto orient = Quaternion::CreateFromAxisAngle(axis, amplitude * sin((frequency * frame) + phase)) * baseOrient;
+					orient.Normalize();
+					track.push_back(orient);
+				}
+			}
+		}
+
+		// Bone orientation relative to chain root, as renderer accumulates it down hierarchy.
+		auto getChainOrientation = [](const auto& getOrientation, int frame)
+		{
+			auto orient = Quaternion::Identity;
+			for (int bone = 0; bone < BONE_COUNT; bone++)
+				orient = getOrientation(bone, frame) * orient;
+
+			return orient;
+		};
+
+		auto packedOrientations = std::vector<PackedQuaternion>{};
+		auto trackKeys = std::vector<PackedQuaternion>{};
+		float losslessChainError = 0.0f;
+		bool isPassed = true;
+
+		for (float error : { 0.0f, maxError })
+		{
+			auto tracks = std::vector<AnimTrack>(sourceTracks.size());
+			auto keys = std::vector<PackedQuaternion>{};
+			for (int i = 0; i < sourceTracks.size(); i++)
+			{
+				CompressTrack(sourceTracks[i], error / BONE_COUNT, packedOrientations, trackKeys, tracks[i]);
+				tracks[i].KeyIndex = (int)keys.size();
+				keys.insert(keys.end(), trackKeys.begin(), trackKeys.end());
+			}
+
+			float chainError = 0.0f;
+			for (int anim = 0; anim < ANIM_COUNT; anim++)
+			{
+				int trackBase = anim * BONE_COUNT;
+				auto getSource = [&](int bone, int frame) { return sourceTracks[trackBase + bone][frame]; };
+				auto getDecoded = [&](int bone, int frame)
+				{
+					const auto& track = tracks[trackBase + bone];
+					return DecodeTrack(track, &keys[track.KeyIndex], frame);
+				};
+
+				for (int frame = 0; frame < KEYFRAME_COUNT; frame++)
+					chainError = std::max(chainError, GetAngularError(getChainOrientation(getSource, frame), getChainOrientation(getDecoded, frame)));
+			}
+
+			// Chain error may exceed bound only by quantization, which is measured by lossless pass.
+			if (error == 0.0f)
+				losslessChainError = chainError;
+			else if (chainError > (error + losslessChainError))
+				isPassed = false;
+
+			// Time decoding of random poses between neighbouring keyframes.
+			auto flatKeyframes = std::vector<Quaternion>{};
+			for (const auto& track : sourceTracks)
+				flatKeyframes.insert(flatKeyframes.end(), track.begin(), track.end());
+
+			auto queries = std::vector<std::pair<int, float>>(POSE_COUNT);
+			for (auto& query : queries)
+				query = std::pair(std::uniform_int_distribution<int>(0, (ANIM_COUNT * (KEYFRAME_COUNT - 1)) - 1)(generator), getRandom(0.0f, 1.0f));
+
+			Quaternion pose[BONE_COUNT];
+			float decodedSum = 0.0f;
+			auto startTime = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < FRAME_COUNT; i++)
+			{
+				for (const auto& [keyframe, alpha] : queries)
+				{
+					int trackBase = (keyframe / (KEYFRAME_COUNT - 1)) * BONE_COUNT;
+					int frame = keyframe % (KEYFRAME_COUNT - 1);
+					for (int bone = 0; bone < BONE_COUNT; bone++)
+					{
+						const auto& track = tracks[trackBase + bone];
+						pose[bone] = Quaternion::Slerp(DecodeTrack(track, &keys[track.KeyIndex], frame), DecodeTrack(track, &keys[track.KeyIndex], frame + 1), alpha);
+					}
+
+					decodedSum += abs(pose[BONE_COUNT - 1].w);
+				}
+			}
+			auto decodedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+			float flatSum = 0.0f;
+			startTime = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < FRAME_COUNT; i++)
+			{
+				for (const auto& [keyframe, alpha] : queries)
+				{
+					int trackBase = (keyframe / (KEYFRAME_COUNT - 1)) * BONE_COUNT;
+					int frame = keyframe % (KEYFRAME_COUNT - 1);
+					for (int bone = 0; bone < BONE_COUNT; bone++)
+					{
+						const auto* keyframes = &flatKeyframes[(trackBase + bone) * KEYFRAME_COUNT];
+						pose[bone] = Quaternion::Slerp(keyframes[frame], keyframes[frame + 1], alpha);
+					}
+
+					flatSum += abs(pose[BONE_COUNT - 1].w);
+				}
+			}
+			auto flatTime = std::chrono::high_resolution_clock::now() - startTime;
+
+			size_t sourceSize = sizeof(Quaternion) * flatKeyframes.size();
+			size_t compressedSize = (sizeof(AnimTrack) * tracks.size()) + (sizeof(PackedQuaternion) * keys.size());
+
+			using us = std::chrono::duration<double, std::micro>;
+			constexpr auto POSE_TOTAL = (double)FRAME_COUNT * POSE_COUNT;
+			TENLog("Animation compression with error bound " + std::to_string(error / RADIAN) + " deg: ratio " +
+				   std::to_string((float)sourceSize / (float)compressedSize) + ", max chain error " + std::to_string(chainError / RADIAN) + " deg over " +
+				   std::to_string(BONE_COUNT) + " bones. " + std::to_string(us(decodedTime).count() / POSE_TOTAL) + " us per pose decoded (uncompressed " +
+				   std::to_string(us(flatTime).count() / POSE_TOTAL) + " us, checksums " + std::to_string(decodedSum) + " and " + std::to_string(flatSum) + ").", LogLevel::Info);
+		}
+
+		return isPassed;
+	}
+}
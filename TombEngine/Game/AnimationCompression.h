@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <SimpleMath.h>
+
+namespace TEN::Animation
+{
+	// Smallest-three quaternion in 48 bits: index of dropped largest component in low 2 bits,
+	// followed by three remaining components quantized to 15 bits each.
+	struct PackedQuaternion
+	{
+		uint16_t Data[3] = {};
+
+		bool operator ==(const PackedQuaternion& quat) const;
+	};
+
+	// Orientations of one bone over contiguous run of keyframes. Constant tracks store single key;
+	// reduced tracks store every (1 << Shift)-th keyframe plus last one and slerp between them.
+	struct AnimTrack
+	{
+		int			  KeyIndex	 = 0; // First entry in g_Level.BoneOrientations.
+		short		  FrameCount = 0;
+		unsigned char Shift		 = 0;
+		bool		  IsConstant = false;
+	};
+
+	PackedQuaternion PackQuaternion(const Quaternion& quat);
+	Quaternion		 UnpackQuaternion(const PackedQuaternion& packedQuat);
+	Quaternion		 GetTrackOrientation(const AnimTrack& track, int frame);
+
+	void CompressAnimations(const std::vector<Quaternion>& orientations, const std::vector<int>& frameOrientationIndices, float maxError, bool logAnims);
+
+	bool BenchmarkAnimationCompression(float maxError);
+}
@@ -53,7 +53,7 @@ LaraInfo Lara = {};
 ItemInfo* LaraItem;
 CollisionInfo LaraCollision = {};
 
-std::function<LaraRoutineFunction> lara_control_routines[NUM_LARA_STATES + 1] =
+LaraRoutineFunction* const lara_control_routines[NUM_LARA_STATES + 1] =
 {
 	lara_as_walk_forward,
 	lara_as_run_forward,
@@ -247,7 +247,7 @@ std::function<LaraRoutineFunction> lara_control_routines[NUM_LARA_STATES + 1] =
 	lara_as_use_puzzle,//189
 };
 
-std::function<LaraRoutineFunction> lara_collision_routines[NUM_LARA_STATES + 1] =
+LaraRoutineFunction* const lara_collision_routines[NUM_LARA_STATES + 1] =
 {
 	lara_col_walk_forward,
 	lara_col_run_forward,
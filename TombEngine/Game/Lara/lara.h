@@ -99,9 +99,9 @@ extern CollisionInfo LaraCollision;
 #define CHECK_LARA_MESHES(slot, mesh) Lara.meshPtrs[mesh] == MESHES(slot, mesh)
 #define INIT_LARA_MESHES(mesh, to, from) Lara.meshPtrs[mesh] = LARA_MESHES(to, mesh) = LARA_MESHES(from, mesh)
 
-#define LaraRoutineFunction void(ItemInfo* item, CollisionInfo* coll)
-extern std::function<LaraRoutineFunction> lara_control_routines[NUM_LARA_STATES + 1];
-extern std::function<LaraRoutineFunction> lara_collision_routines[NUM_LARA_STATES + 1];
+using LaraRoutineFunction = void(ItemInfo* item, CollisionInfo* coll);
+extern LaraRoutineFunction* const lara_control_routines[NUM_LARA_STATES + 1];
+extern LaraRoutineFunction* const lara_collision_routines[NUM_LARA_STATES + 1];
 
 void LaraControl(ItemInfo* item, CollisionInfo* coll);
 void LaraAboveWater(ItemInfo* item, CollisionInfo* coll);
@@ -27,6 +27,10 @@
 #include "Objects/Utils/object_helper.h"
 #include "Specific/level.h"
 
+#include <chrono>
+#include <functional>
+#include <random>
+
 using namespace TEN::Effects::Hair;
 using namespace TEN::Entities;
 using namespace TEN::Entities::Switches;
@@ -137,3 +141,75 @@ void InitializeObjects()
 	SequenceUsed[4] = 0;
 	SequenceUsed[5] = 0;
 }
+
+// Stand-ins for object control routines. Each does a little distinct work, so calls can't be folded together.
+static unsigned int DispatchBenchmarkSum = 0;
+static void DispatchBenchmarkRoutine0(short itemNumber) { DispatchBenchmarkSum += itemNumber; }
+static void DispatchBenchmarkRoutine1(short itemNumber) { DispatchBenchmarkSum ^= itemNumber * 3; }
+static void DispatchBenchmarkRoutine2(short itemNumber) { DispatchBenchmarkSum += itemNumber << 2; }
+static void DispatchBenchmarkRoutine3(short itemNumber) { DispatchBenchmarkSum = (DispatchBenchmarkSum * 31) + itemNumber; }
+static void DispatchBenchmarkRoutine4(short itemNumber) { DispatchBenchmarkSum -= itemNumber; }
+static void DispatchBenchmarkRoutine5(short itemNumber) { DispatchBenchmarkSum ^= itemNumber << 5; }
+static void DispatchBenchmarkRoutine6(short itemNumber) { DispatchBenchmarkSum += itemNumber * 7; }
+static void DispatchBenchmarkRoutine7(short itemNumber) { DispatchBenchmarkSum = (DispatchBenchmarkSum >> 1) + itemNumber; }
+
+// Calls control routines for random item list through ObjectInfo function pointers and through std::function,
+// as object table used to store them. Checks both give same result and logs time per call.
+bool BenchmarkObjectDispatch()
+{
+	constexpr auto FRAME_COUNT = 10000;
+	constexpr auto ITEM_COUNT  = 256;
+
+	constexpr ObjectControlFunction* ROUTINES[] =
+	{
+		DispatchBenchmarkRoutine0, DispatchBenchmarkRoutine1, DispatchBenchmarkRoutine2, DispatchBenchmarkRoutine3,
+		DispatchBenchmarkRoutine4, DispatchBenchmarkRoutine5, DispatchBenchmarkRoutine6, DispatchBenchmarkRoutine7
+	};
+	constexpr auto ROUTINE_COUNT = (int)(sizeof(ROUTINES) / sizeof(ROUTINES[0]));
+
+	struct LegacyObjectInfo
+	{
+		std::function<void(short itemNumber)> control = nullptr;
+	};
+
+	auto objects = std::vector<ObjectInfo>(ROUTINE_COUNT);
+	auto legacyObjects = std::vector<LegacyObjectInfo>(ROUTINE_COUNT);
+	for (int i = 0; i < ROUTINE_COUNT; i++)
+	{
+		objects[i].control = ROUTINES[i];
+		legacyObjects[i].control = ROUTINES[i];
+	}
+
+	// Fixed seed keeps report reproducible between runs.
+	auto generator = std::mt19937(ITEM_COUNT);
+	auto itemObjects = std::vector<int>(ITEM_COUNT);
+	for (auto& objectIndex : itemObjects)
+		objectIndex = std::uniform_int_distribution<int>(0, ROUTINE_COUNT - 1)(generator);
+
+	DispatchBenchmarkSum = 0;
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		for (int itemNumber = 0; itemNumber < ITEM_COUNT; itemNumber++)
+			objects[itemObjects[itemNumber]].control(itemNumber);
+	}
+	auto pointerTime = std::chrono::high_resolution_clock::now() - startTime;
+	unsigned int pointerSum = DispatchBenchmarkSum;
+
+	DispatchBenchmarkSum = 0;
+	startTime = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		for (int itemNumber = 0; itemNumber < ITEM_COUNT; itemNumber++)
+			legacyObjects[itemObjects[itemNumber]].control(itemNumber);
+	}
+	auto functionTime = std::chrono::high_resolution_clock::now() - startTime;
+	unsigned int functionSum = DispatchBenchmarkSum;
+
+	using ns = std::chrono::duration<double, std::nano>;
+	constexpr auto CALL_COUNT = (double)FRAME_COUNT * ITEM_COUNT;
+	TENLog("Object dispatch: " + std::to_string(ns(pointerTime).count() / CALL_COUNT) + " ns per call through function pointer, " +
+		   std::to_string(ns(functionTime).count() / CALL_COUNT) + " ns through std::function.", LogLevel::Info);
+
+	return (pointerSum == functionSum);
+}
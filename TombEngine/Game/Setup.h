@@ -58,6 +58,15 @@ enum ShatterType
 	SHT_EXPLODE
 };
 
+// Object routines are plain function pointers, so calls are direct and ObjectInfo stays trivially copyable.
+using ObjectInitializeFunction = void(short itemNumber);
+using ObjectControlFunction	   = void(short itemNumber);
+using ObjectCollisionFunction  = void(short itemNumber, ItemInfo* laraItem, CollisionInfo* coll);
+using ObjectHitFunction		   = void(ItemInfo& target, ItemInfo& source, std::optional<GameVector> pos, int damage, bool isExplosive, int jointIndex);
+using ObjectDrawFunction	   = void(ItemInfo* item);
+using ObjectHeightFunction	   = std::optional<int>(short itemNumber, int x, int y, int z);
+using ObjectBorderFunction	   = int(short itemNumber);
+
 struct ObjectInfo
 {
 	bool loaded = false; // IsLoaded
@@ -87,17 +96,17 @@ struct ObjectInfo
 
 	DWORD explodableMeshbits;
 
-	std::function<void(short itemNumber)> Initialize;
-	std::function<void(short itemNumber)> control;
-	std::function<void(short itemNumber, ItemInfo* laraItem, CollisionInfo* coll)> collision;
+	ObjectInitializeFunction* Initialize = nullptr;
+	ObjectControlFunction*	  control	 = nullptr;
+	ObjectCollisionFunction*  collision	 = nullptr;
 
-	std::function<void(ItemInfo& target, ItemInfo& source, std::optional<GameVector> pos, int damage, bool isExplosive, int jointIndex)> HitRoutine;
-	std::function<void(ItemInfo* item)> drawRoutine;
+	ObjectHitFunction*	HitRoutine	= nullptr;
+	ObjectDrawFunction* drawRoutine = nullptr;
 
-	std::function<std::optional<int>(int itemNumber, int x, int y, int z)> floor;
-	std::function<std::optional<int>(int itemNumber, int x, int y, int z)> ceiling;
-	std::function<int(short itemNumber)> floorBorder;
-	std::function<int(short itemNumber)> ceilingBorder;
+	ObjectHeightFunction* floor			= nullptr;
+	ObjectHeightFunction* ceiling		= nullptr;
+	ObjectBorderFunction* floorBorder	= nullptr;
+	ObjectBorderFunction* ceilingBorder = nullptr;
 
 	// NOTE: ROT_X/Y/Z allows bones to be rotated with CreatureJoint().
 	void SetBoneRotationFlags(int boneNumber, int flags)
@@ -215,3 +224,5 @@ extern StaticInfo StaticObjects[MAX_STATICS];
 void InitializeGameFlags();
 void InitializeSpecialEffects();
 void InitializeObjects();
+
+bool BenchmarkObjectDispatch();
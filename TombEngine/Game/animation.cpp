@@ -15,6 +15,9 @@
 #include "Sound/sound.h"
 #include "Specific/level.h"
 
+#include <chrono>
+#include <random>
+
 using namespace TEN::Entities::Generic;
 using namespace TEN::Math;
 using TEN::Renderer::g_Renderer;
@@ -494,6 +497,45 @@ AnimFrameInterpData GetFrameInterpData(const ItemInfo& item)
 	return AnimFrameInterpData{ framePtr0, framePtr1, alpha };
 }
 
+// Number of bones which can be interpolated between both keyframes.
+int GetFramePoseBoneCount(const AnimFrameInterpData& frameData)
+{
+	if (frameData.Alpha == 0.0f)
+		return frameData.FramePtr0->BoneCount;
+
+	return std::min(frameData.FramePtr0->BoneCount, frameData.FramePtr1->BoneCount);
+}
+
+// Interpolates orientations of whole skeleton at once. Keyframe orientations are stored compressed
+// per bone track and decoded here on demand.
+void InterpolateFramePose(const AnimFrameInterpData& frameData, Quaternion* orientations, int boneCount)
+{
+	if (boneCount <= 0)
+		return;
+
+	const auto& frame0 = *frameData.FramePtr0;
+	const auto* tracks0 = &g_Level.AnimTracks[frame0.TrackIndex];
+
+	if (frameData.Alpha == 0.0f)
+	{
+		for (int i = 0; i < boneCount; i++)
+			orientations[i] = GetTrackOrientation(tracks0[i], frame0.TrackFrame);
+
+		return;
+	}
+
+	const auto& frame1 = *frameData.FramePtr1;
+	const auto* tracks1 = &g_Level.AnimTracks[frame1.TrackIndex];
+	auto alpha = XMVectorReplicate(frameData.Alpha);
+
+	for (int i = 0; i < boneCount; i++)
+	{
+		auto quat0 = GetTrackOrientation(tracks0[i], frame0.TrackFrame);
+		auto quat1 = GetTrackOrientation(tracks1[i], frame1.TrackFrame);
+		XMStoreFloat4(&orientations[i], XMQuaternionSlerpV(XMLoadFloat4(&quat0), XMLoadFloat4(&quat1), alpha));
+	}
+}
+
 const AnimFrame& GetAnimFrame(const ItemInfo& item, int animNumber, int frameNumber)
 {
 	return *GetFrame(item.ObjectNumber, animNumber, frameNumber);
@@ -705,3 +747,164 @@ float GetBoneLength(GAME_OBJECT_ID objectID, int boneIndex)
 	auto nextBoneOffset = GetJointOffset(objectID, boneIndex + 1);
 	return nextBoneOffset.Length();
 }
+
+// Interpolates poses of random animated items from keyframes stored as separate orientation vector per frame,
+// with quaternion-matrix round trip per bone as renderer used to do, and from one flat orientation pool
+// interpolated in single pass. Checks both give same bone matrices and logs time per pose.
+bool BenchmarkFramePose()
+{
+	constexpr auto ANIM_COUNT	  = 64;
+	constexpr auto KEYFRAME_COUNT = 32;
+	constexpr auto BONE_COUNT	  = 15;
+	constexpr auto POSE_COUNT	  = 256;
+	constexpr auto FRAME_COUNT	  = 1000;
+	constexpr auto MATRIX_TOLERANCE = 0.001f;
+
+	struct LegacyAnimFrame
+	{
+		std::vector<Quaternion> BoneOrientations = {};
+	};
+
+	struct PoseQuery
+	{
+		int	  Keyframe = 0;
+		float Alpha	   = 0.0f;
+	};
+
+	// Fixed seed keeps report reproducible between runs.
+	auto generator = std::mt19937(BONE_COUNT);
+	auto getRandom = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(generator); };
+	auto getRandomQuat = [&](float maxAngle)
+	{
+		auto axis = Vector3(getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f), getRandom(-1.0f, 1.0f)) + Vector3(0.0f, 0.01f, 0.0f);
+		axis.Normalize();
+		return Quaternion::CreateFromAxisAngle(axis, getRandom(-maxAngle, maxAngle));
+	};
+
+	// Keyframes drift smoothly from random start, as in real animations. Legacy frames are allocated
+	// one by one in load order, as loader used to do.
+	auto legacyFrames = std::vector<LegacyAnimFrame>(ANIM_COUNT * KEYFRAME_COUNT);
+	auto pool = std::vector<Quaternion>(ANIM_COUNT * KEYFRAME_COUNT * BONE_COUNT);
+	for (int anim = 0; anim < ANIM_COUNT; anim++)
+	{
+		auto orientations = std::vector<Quaternion>(BONE_COUNT);
+		for (auto& orient : orientations)
+			orient = getRandomQuat(PI);
+
+		for (int keyframe = 0; keyframe < KEYFRAME_COUNT; keyframe++)
+		{
+			int frameIndex = (anim * KEYFRAME_COUNT) + keyframe;
+			for (auto& orient : orientations)
+			{
+				orient = getRandomQuat(20.0f * RADIAN) * orient;
+				orient.Normalize();
+			}
+
+			legacyFrames[frameIndex].BoneOrientations = orientations;
+			std::copy(orientations.begin(), orientations.end(), &pool[frameIndex * BONE_COUNT]);
+		}
+	}
+
+	auto queries = std::vector<PoseQuery>(POSE_COUNT);
+	for (auto& query : queries)
+	{
+		int anim = std::uniform_int_distribution<int>(0, ANIM_COUNT - 1)(generator);
+		query.Keyframe = (anim * KEYFRAME_COUNT) + std::uniform_int_distribution<int>(0, KEYFRAME_COUNT - 2)(generator);
+
+		// Quarter of items sit exactly on keyframe.
+		query.Alpha = (std::uniform_int_distribution<int>(0, 3)(generator) == 0) ? 0.0f : getRandom(0.0f, 1.0f);
+	}
+
+	auto legacyPose = [&](const PoseQuery& query, Matrix* matrices)
+	{
+		const auto& frame0 = legacyFrames[query.Keyframe];
+		const auto& frame1 = legacyFrames[query.Keyframe + 1];
+
+		for (int bone = 0; bone < BONE_COUNT; bone++)
+		{
+			auto rotMatrix = Matrix::CreateFromQuaternion(frame0.BoneOrientations[bone]);
+			if (query.Alpha != 0.0f)
+			{
+				auto rotMatrix2 = Matrix::CreateFromQuaternion(frame1.BoneOrientations[bone]);
+
+				auto quat1 = Quaternion::CreateFromRotationMatrix(rotMatrix);
+				auto quat2 = Quaternion::CreateFromRotationMatrix(rotMatrix2);
+				auto quat3 = Quaternion::Slerp(quat1, quat2, query.Alpha);
+
+				rotMatrix = Matrix::CreateFromQuaternion(quat3);
+			}
+
+			matrices[bone] = rotMatrix;
+		}
+	};
+
+	auto poolPose = [&](const PoseQuery& query, Quaternion* orientations, Matrix* matrices)
+	{
+		const auto* orientations0 = &pool[query.Keyframe * BONE_COUNT];
+		if (query.Alpha == 0.0f)
+		{
+			std::copy(orientations0, orientations0 + BONE_COUNT, orientations);
+		}
+		else
+		{
+			const auto* orientations1 = orientations0 + BONE_COUNT;
+			auto alpha = XMVectorReplicate(query.Alpha);
+
+			for (int bone = 0; bone < BONE_COUNT; bone++)
+				XMStoreFloat4(&orientations[bone], XMQuaternionSlerpV(XMLoadFloat4(&orientations0[bone]), XMLoadFloat4(&orientations1[bone]), alpha));
+		}
+
+		for (int bone = 0; bone < BONE_COUNT; bone++)
+			matrices[bone] = Matrix::CreateFromQuaternion(orientations[bone]);
+	};
+
+	Quaternion orientations[BONE_COUNT];
+	Matrix legacyMatrices[BONE_COUNT];
+	Matrix poolMatrices[BONE_COUNT];
+	float legacySum = 0.0f;
+	float poolSum = 0.0f;
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		for (const auto& query : queries)
+		{
+			legacyPose(query, legacyMatrices);
+			legacySum += legacyMatrices[BONE_COUNT - 1]._11;
+		}
+	}
+	auto legacyTime = std::chrono::high_resolution_clock::now() - startTime;
+
+	startTime = std::chrono::high_resolution_clock::now();
+	for (int frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		for (const auto& query : queries)
+		{
+			poolPose(query, orientations, poolMatrices);
+			poolSum += poolMatrices[BONE_COUNT - 1]._11;
+		}
+	}
+	auto poolTime = std::chrono::high_resolution_clock::now() - startTime;
+
+	// Compare bone matrices once, outside timed loops.
+	float maxDelta = 0.0f;
+	for (const auto& query : queries)
+	{
+		legacyPose(query, legacyMatrices);
+		poolPose(query, orientations, poolMatrices);
+
+		for (int bone = 0; bone < BONE_COUNT; bone++)
+		{
+			for (int i = 0; i < 16; i++)
+				maxDelta = std::max(maxDelta, abs((&legacyMatrices[bone]._11)[i] - (&poolMatrices[bone]._11)[i]));
+		}
+	}
+
+	using us = std::chrono::duration<double, std::micro>;
+	constexpr auto POSE_TOTAL = (double)FRAME_COUNT * POSE_COUNT;
+	TENLog("Frame pose: " + std::to_string(BONE_COUNT) + " bones, max matrix delta " + std::to_string(maxDelta) + ". " +
+		   std::to_string(us(poolTime).count() / POSE_TOTAL) + " us per pose from flat pool (per-frame vectors " +
+		   std::to_string(us(legacyTime).count() / POSE_TOTAL) + " us, checksums " + std::to_string(poolSum) + " and " + std::to_string(legacySum) + ").", LogLevel::Info);
+
+	return (maxDelta <= MATRIX_TOLERANCE);
+}
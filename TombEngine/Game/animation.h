@@ -32,9 +32,11 @@ enum class AnimCommandType
 
 struct AnimFrame
 {
-	GameBoundingBox			BoundingBox		 = GameBoundingBox::Zero;
-	Vector3					Offset			 = Vector3::Zero;
-	std::vector<Quaternion> BoneOrientations = {};
+	GameBoundingBox BoundingBox = GameBoundingBox::Zero;
+	Vector3			Offset		= Vector3::Zero;
+	int				TrackIndex	= 0; // First bone track in g_Level.AnimTracks.
+	int				TrackFrame	= 0; // Frame index within bone tracks.
+	int				BoneCount	= 0;
 };
 
 struct StateDispatchData
@@ -122,6 +124,8 @@ const AnimData& GetAnimData(const ItemInfo& item, int animNumber = NO_ANIM);
 const AnimData& GetAnimData(const ItemInfo* item, int animNumber = NO_ANIM); // Deprecated.
 
 AnimFrameInterpData GetFrameInterpData(const ItemInfo& item);
+int					GetFramePoseBoneCount(const AnimFrameInterpData& frameData);
+void				InterpolateFramePose(const AnimFrameInterpData& frameData, Quaternion* orientations, int boneCount);
 const AnimFrame&	GetAnimFrame(const ItemInfo& item, int animNumber, int frameNumber);
 const AnimFrame*	GetFrame(GAME_OBJECT_ID objectID, int animNumber, int frameNumber);
 const AnimFrame*	GetFirstFrame(GAME_OBJECT_ID objectID, int animNumber);
@@ -153,3 +157,5 @@ Vector3i   GetJointPosition(const ItemInfo& item, const CreatureBiteInfo& bite);
 Vector3	   GetJointOffset(GAME_OBJECT_ID objectID, int jointIndex);
 Quaternion GetBoneOrientation(const ItemInfo& item, int boneIndex);
 float	   GetBoneLength(GAME_OBJECT_ID objectID, int boneIndex);
+
+bool BenchmarkFramePose();
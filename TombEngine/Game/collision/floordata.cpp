@@ -12,6 +12,12 @@
 using namespace TEN::Collision::Floordata;
 using namespace TEN::Math;
 
+int FloorInfo::GetRoomNumber() const
+{
+	// Flipmaps move sector data between rooms, so resolve current room through slot table.
+	return g_Level.RoomSlots[SourceRoom];
+}
+
 int FloorInfo::GetSurfacePlaneIndex(int x, int z, bool isFloor) const
 {
 	// Calculate bias.
@@ -113,7 +113,7 @@ class FloorInfo
 {
 	public:
 		// Components
-		int					   Room				 = 0; // RoomNumber
+		int					   SourceRoom		 = 0; // Room number sector was loaded into. Use GetRoomNumber() for current one.
 		int					   WallPortal		 = 0; // Number of room through wall portal (only one)?
 		SurfaceCollisionData   FloorCollision	 = {};
 		SurfaceCollisionData   CeilingCollision  = {};
@@ -123,10 +123,11 @@ class FloorInfo
 		MaterialType Material = MaterialType::Stone;
 
 		int	 Box		  = 0;
-		int	 TriggerIndex = 0;
+		int	 TriggerIndex = 0; // Index into g_Level.Triggers, or NO_TRIGGER.
 		bool Stopper	  = true;
 
 		// Getters
+		int		GetRoomNumber() const;
 		int		GetSurfacePlaneIndex(int x, int z, bool isFloor) const;
 		Vector2 GetSurfaceTilt(int x, int z, bool isFloor) const;
 
@@ -53,6 +53,7 @@
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Scripting/Include/Strings/ScriptInterfaceStringsHandler.h"
 #include "Sound/sound.h"
+#include "Specific/benchmark.h"
 #include "Specific/clock.h"
 #include "Specific/Input/Input.h"
 #include "Specific/level.h"
@@ -100,10 +101,10 @@ int SystemNameHash = 0;
 bool  InItemControlLoop;
 short ItemNewRoomNo;
 short ItemNewRooms[MAX_ROOMS];
-short NextItemActive;
 short NextItemFree;
-short NextFxActive;
 short NextFxFree;
+std::vector<short> ActiveItems	 = {};
+std::vector<short> ActiveEffects = {};
 
 int ControlPhaseTime;
 
@@ -171,6 +172,7 @@ GameStatus ControlPhase(int numFrames)
 		ClearActionQueue();
 
 		UpdateAllItems();
+		UpdateRopes();
 		UpdateAllEffects();
 		UpdateLara(LaraItem, isTitle);
 
@@ -310,6 +312,14 @@ GameStatus DoLevel(int levelIndex, bool loadGame)
 	// Initialize game variables and optionally load game.
 	InitializeOrLoadGame(loadGame);
 
+	// Run level benchmarks and quit, if requested.
+	if (IsBenchmarkRequested(true))
+	{
+		RunBenchmarks(true);
+		EndGameLoop(levelIndex, GameStatus::ExitGame);
+		return GameStatus::ExitGame;
+	}
+
 	// DoGameLoop() returns only when level has ended.
 	return DoGameLoop(levelIndex);
 }
@@ -401,7 +411,7 @@ void CleanUp()
 	ActiveCreatures.clear();
 
 	// Clear ropes.
-	Ropes.clear();
+	ClearRopes();
 
 	// Clear camera data.
 	ClearSpotCamSequences();
@@ -570,7 +580,9 @@ GameStatus DoGameLoop(int levelIndex)
 		}
 
 		numFrames = DrawPhase(!levelIndex);
-		Sound_UpdateScene();
+
+		// Frame count is in 1/60 second ticks, as two are used per game frame. Clamp it as ControlPhase() does.
+		Sound_UpdateScene(std::clamp(numFrames, 0, 10) * (DELTA_TIME / 2));
 	}
 
 	EndGameLoop(levelIndex, result);
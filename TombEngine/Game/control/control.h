@@ -63,15 +63,13 @@ extern int SystemNameHash;
 extern bool  InItemControlLoop;
 extern short ItemNewRoomNo;
 extern short ItemNewRooms[MAX_ROOMS];
-extern short NextItemActive;
 extern short NextItemFree;
-extern short NextFxActive;
 extern short NextFxFree;
+extern std::vector<short> ActiveItems;
+extern std::vector<short> ActiveEffects;
 
 extern int ControlPhaseTime;
 
-extern std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
-
 int DrawPhase(bool isTitle);
 
 GameStatus ControlPhase(int numFrames);
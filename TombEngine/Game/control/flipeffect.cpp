@@ -204,28 +204,26 @@ void LaraHandsFree(ItemInfo* item)
 
 void KillActiveBaddys(ItemInfo* item)
 {
-	if (NextItemActive != NO_ITEM)
+	// Iterate over copy, because RemoveActiveItem() may reorder active item list.
+	auto activeItems = ActiveItems;
+	for (short itemNumber : activeItems)
 	{
-		short itemNumber = NextItemActive;
+		if (itemNumber == NO_ITEM)
+			continue;
 
-		do
+		auto* targetItem = &g_Level.Items[itemNumber];
+
+		if (Objects[targetItem->ObjectNumber].intelligent)
 		{
-			auto* targetItem = &g_Level.Items[itemNumber];
+			targetItem->Status = ITEM_INVISIBLE;
 
-			if (Objects[targetItem->ObjectNumber].intelligent)
+			if (*(int*)&item != 0xABCDEF)
 			{
-				targetItem->Status = ITEM_INVISIBLE;
-
-				if (*(int*)&item != 0xABCDEF)
-				{
-					RemoveActiveItem(itemNumber);
-					DisableEntityAI(itemNumber);
-					targetItem->Flags |= IFLAG_INVISIBLE;
-				}
+				RemoveActiveItem(itemNumber);
+				DisableEntityAI(itemNumber);
+				targetItem->Flags |= IFLAG_INVISIBLE;
 			}
-
-			itemNumber = targetItem->NextActive;
-		} while (itemNumber != NO_ITEM);
+		}
 	}
 
 	FlipEffect = -1;
@@ -1,6 +1,8 @@
 #include "framework.h"
 #include "Game/control/trigger.h"
 
+#include <unordered_map>
+
 #include "Game/camera.h"
 #include "Game/collision/floordata.h"
 #include "Game/control/flipeffect.h"
@@ -64,52 +66,37 @@ int TriggerActive(ItemInfo* item)
 
 bool GetKeyTrigger(ItemInfo* item)
 {
-	short* triggerIndexPtr = GetTriggerIndex(item);
-	if (triggerIndexPtr == nullptr)
-		return false;
-
-	short* triggerPtr = triggerIndexPtr;
-	if (*triggerPtr & END_BIT)
+	const auto* trigger = GetTrigger(item);
+	if (trigger == nullptr)
 		return false;
 
-	for (short* j = &triggerPtr[2]; (*j >> 8) & 0x3C || item != &g_Level.Items[*j & VALUE_BITS]; j++)
+	for (int i = 0; i < trigger->ActionCount; i++)
 	{
-		if (*j & END_BIT)
-			return false;
+		const auto& action = GetTriggerAction(*trigger, i);
+		if (action.Type == TO_OBJECT && item == &g_Level.Items[action.Value])
+			return true;
 	}
 
-	return true;
+	return false;
 }
 
 // NOTE: attatchedToSwitch parameter unused.
 int GetSwitchTrigger(ItemInfo* item, short* itemNumbersPtr, int attatchedToSwitch)
 {
-	short* triggerIndexPtr = GetTriggerIndex(item);
-	if (triggerIndexPtr == nullptr)
+	const auto* trigger = GetTrigger(item);
+	if (trigger == nullptr)
 		return 0;
 
-	short* trigger = triggerIndexPtr;
-	if (*trigger & END_BIT)
-		return 0;
-
-	trigger += 2;
-	short* currentPtr = itemNumbersPtr;
 	int k = 0;
-
-	do
+	for (int i = 0; i < trigger->ActionCount; i++)
 	{
-		if (TRIG_BITS(*trigger) == TO_OBJECT && item != &g_Level.Items[*trigger & VALUE_BITS])
+		const auto& action = GetTriggerAction(*trigger, i);
+		if (action.Type == TO_OBJECT && item != &g_Level.Items[action.Value])
 		{
-			currentPtr[k] = *trigger & VALUE_BITS;
+			itemNumbersPtr[k] = action.Value;
 			++k;
 		}
-
-		if (*trigger & END_BIT)
-			break;
-
-		++trigger;
-
-	} while (true);
+	}
 
 	return k;
 }
@@ -259,22 +246,18 @@ bool PickupTrigger(short itemNumber)
 	return true;
 }
 
-void RefreshCamera(short type, short* data)
+void RefreshCamera(const TriggerInfo& trigger)
 {
-	short trigger, value, targetOk;
+	int targetOk = 2;
 
-	targetOk = 2;
-
-	do
+	for (int i = 0; i < trigger.ActionCount; i++)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
+		const auto& action = GetTriggerAction(trigger, i);
+		short value = action.Value;
 
-		switch (TRIG_BITS(trigger))
+		switch (action.Type)
 		{
 		case TO_CAMERA:
-			data++;
-
 			if (value == Camera.last)
 			{
 				Camera.number = value;
@@ -300,7 +283,7 @@ void RefreshCamera(short type, short* data)
 			Camera.item = &g_Level.Items[value];
 			break;
 		}
-	} while (!(trigger & END_BIT));
+	}
 
 	if (Camera.item)
 		if (!targetOk || (targetOk == 2 && Camera.item->LookedAt && Camera.item != Camera.lastItem))
@@ -310,21 +293,135 @@ void RefreshCamera(short type, short* data)
 		Camera.timer = -1;
 }
 
-short* GetTriggerIndex(FloorInfo* floor, int x, int y, int z)
+const TriggerInfo* GetTrigger(FloorInfo* floor, int x, int y, int z)
 {
-	auto bottomBlock = GetCollision(x, y, z, floor->Room).BottomBlock; 
+	// Triggers are stored in bottom sector. Only probe for it if there is floor portal below,
+	// so that common case of sector without trigger and portal is rejected without any collision query.
+	auto* bottomBlock = floor;
+	if (floor->GetRoomNumberBelow(x, z).has_value())
+		bottomBlock = GetCollision(x, y, z, floor->GetRoomNumber()).BottomBlock;
 
-	if (bottomBlock->TriggerIndex == -1)
+	if (bottomBlock->TriggerIndex == NO_TRIGGER)
 		return nullptr;
 
-	return &g_Level.FloorData[bottomBlock->TriggerIndex];
+	return &g_Level.Triggers[bottomBlock->TriggerIndex];
 }
 
-short* GetTriggerIndex(ItemInfo* item)
+const TriggerInfo* GetTrigger(ItemInfo* item)
 {
 	auto roomNumber = item->RoomNumber;
 	auto floor = GetFloor(item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z, &roomNumber);
-	return GetTriggerIndex(floor, item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
+	return GetTrigger(floor, item->Pose.Position.x, item->Pose.Position.y, item->Pose.Position.z);
+}
+
+const TriggerAction& GetTriggerAction(const TriggerInfo& trigger, int index)
+{
+	return g_Level.TriggerActions[trigger.FirstAction + index];
+}
+
+// Decodes single trigger from floordata opcode stream. Returns false if stream is malformed.
+static bool CompileTrigger(const std::vector<short>& floorData, int offset, TriggerInfo& trigger)
+{
+	auto readWord = [&](short& word)
+	{
+		if (offset < 0 || offset >= floorData.size())
+			return false;
+
+		word = floorData[offset++];
+		return true;
+	};
+
+	short setup = 0;
+	short flags = 0;
+	if (!readWord(setup) || !readWord(flags))
+		return false;
+
+	trigger.Type = (setup >> 8) & TRIGGER_BITS;
+	trigger.Flags = flags;
+	trigger.Timer = flags & TIMER_BITS;
+	trigger.FirstAction = (int)g_Level.TriggerActions.size();
+	trigger.ActionCount = 0;
+
+	while (true)
+	{
+		short word = 0;
+		if (!readWord(word))
+			return false;
+
+		auto action = TriggerAction{};
+		action.Type = (word >> 10) & FUNCTION_BITS;
+		action.Value = word & VALUE_BITS;
+
+		// Camera, flyby and Lua event records carry second word, which holds end bit instead of first one.
+		bool isLast = (word & END_BIT);
+		if (action.Type == TO_CAMERA || action.Type == TO_FLYBY || action.Type == TO_LUAEVENT)
+		{
+			if (!readWord(action.Extra))
+				return false;
+
+			isLast = (action.Extra & END_BIT);
+		}
+
+		g_Level.TriggerActions.push_back(action);
+		trigger.ActionCount++;
+
+		if (isLast)
+			break;
+	}
+
+	// Switch, key and pickup triggers start with record of their own item.
+	if ((trigger.Type == TRIGGER_TYPES::SWITCH || trigger.Type == TRIGGER_TYPES::KEY || trigger.Type == TRIGGER_TYPES::PICKUP) &&
+		GetTriggerAction(trigger, 0).Type != TO_OBJECT)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+// Replaces floordata offsets in room sectors with indices of decoded triggers.
+void CompileTriggers(const std::vector<short>& floorData)
+{
+	g_Level.Triggers.clear();
+	g_Level.TriggerActions.clear();
+
+	auto triggerIndices = std::unordered_map<int, int>{};
+
+	for (int roomNumber = 0; roomNumber < g_Level.Rooms.size(); roomNumber++)
+	{
+		for (auto& sector : g_Level.Rooms[roomNumber].floor)
+		{
+			if (sector.TriggerIndex == NO_TRIGGER)
+				continue;
+
+			auto it = triggerIndices.find(sector.TriggerIndex);
+			if (it == triggerIndices.end())
+			{
+				auto trigger = TriggerInfo{};
+				int triggerIndex = NO_TRIGGER;
+				int actionCount = (int)g_Level.TriggerActions.size();
+
+				if (CompileTrigger(floorData, sector.TriggerIndex, trigger))
+				{
+					triggerIndex = (int)g_Level.Triggers.size();
+					g_Level.Triggers.push_back(trigger);
+				}
+				else
+				{
+					g_Level.TriggerActions.resize(actionCount);
+					TENLog("Malformed trigger at floordata offset " + std::to_string(sector.TriggerIndex) +
+						" in room " + std::to_string(roomNumber) + " was ignored.", LogLevel::Warning);
+				}
+
+				it = triggerIndices.insert({ sector.TriggerIndex, triggerIndex }).first;
+			}
+
+			sector.TriggerIndex = it->second;
+		}
+	}
+
+	TENLog("Compiled " + std::to_string(g_Level.Triggers.size()) + " triggers with " +
+		std::to_string(g_Level.TriggerActions.size()) + " actions.", LogLevel::Info);
 }
 
 void Antitrigger(short const value, short const flags)
@@ -409,19 +506,20 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 	short cameraTimer = 0;
 	int spotCamIndex = 0;
 
-	auto data = GetTriggerIndex(floor, x, y, z);
-
-	if (!data)
+	const auto* triggerPtr = GetTrigger(floor, x, y, z);
+	if (triggerPtr == nullptr)
 		return;
 
-	short triggerType = (*(data++) >> 8) & TRIGGER_BITS;
-	short flags = *(data++);
-	short timer = flags & TIMER_BITS;
+	const auto& triggerInfo = *triggerPtr;
+	short triggerType = triggerInfo.Type;
+	short flags = triggerInfo.Flags;
+	short timer = triggerInfo.Timer;
 
 	if (Camera.type != CameraType::Heavy)
-		RefreshCamera(triggerType, data);
+		RefreshCamera(triggerInfo);
 
 	short value = 0;
+	int firstAction = 0;
 
 	if (heavy)
 	{
@@ -458,7 +556,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		switch (triggerType)
 		{
 		case TRIGGER_TYPES::SWITCH:
-			value = *(data++) & VALUE_BITS;
+			value = GetTriggerAction(triggerInfo, firstAction++).Value;
 
 			if (flags & ONESHOT)
 				g_Level.Items[value].ItemFlags[0] = 1;
@@ -521,14 +619,14 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			return;
 
 		case TRIGGER_TYPES::KEY:
-			value = *(data++) & VALUE_BITS;
+			value = GetTriggerAction(triggerInfo, firstAction++).Value;
 			keyResult = KeyTrigger(value);
 			if (keyResult != -1)
 				break;
 			return;
 
 		case TRIGGER_TYPES::PICKUP:
-			value = *(data++) & VALUE_BITS;
+			value = GetTriggerAction(triggerInfo, firstAction++).Value;
 			if (!PickupTrigger(value))
 				return;
 			break;
@@ -549,19 +647,16 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		}
 	}
 
-	short targetType = 0;
-	short trigger = 0;
-
 	ItemInfo* item = nullptr;
 	ItemInfo* cameraItem = nullptr;
 
-	do
+	for (int i = firstAction; i < triggerInfo.ActionCount; i++)
 	{
-		trigger = *(data++);
-		value = trigger & VALUE_BITS;
-		targetType = (trigger >> 10) & FUNCTION_BITS;
+		const auto& action = GetTriggerAction(triggerInfo, i);
+		value = action.Value;
+		short extra = action.Extra;
 
-		switch (targetType)
+		switch (action.Type)
 		{
 		case TO_OBJECT:
 			item = &g_Level.Items[value];
@@ -637,8 +732,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			break;
 
 		case TO_CAMERA:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -658,16 +751,14 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 
 			if (Camera.number != Camera.last || triggerType == TRIGGER_TYPES::SWITCH)
 			{
-				Camera.timer = (trigger & TIMER_BITS) * FPS;
+				Camera.timer = (extra & TIMER_BITS) * FPS;
 				Camera.type = heavy ? CameraType::Heavy : CameraType::Fixed;
-				if (trigger & ONESHOT)
+				if (extra & ONESHOT)
 					g_Level.Cameras[Camera.number].Flags |= ONESHOT;
 			}
 			break;
 
 		case TO_FLYBY:
-			trigger = *(data++);
-
 			if (keyResult == 1)
 				break;
 
@@ -688,7 +779,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 
 				if (!(SpotCam[spotCamIndex].flags & SCF_CAMERA_ONE_SHOT))
 				{
-					if (trigger & ONESHOT)
+					if (extra & ONESHOT)
 						SpotCam[spotCamIndex].flags |= SCF_CAMERA_ONE_SHOT;
 
 					if (!UseSpotCam || CurrentLevel == 0)
@@ -772,8 +863,6 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 			break;
 
 		case TO_LUAEVENT:
-			trigger = *(data++);
-
 			if (g_Level.EventSets.size() > value)
 			{
 				auto& set = g_Level.EventSets[value];
@@ -785,7 +874,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 				if (!((int)set.Activators & activatorType))
 					continue;
 
-				switch (trigger & TIMER_BITS)
+				switch (extra & TIMER_BITS)
 				{
 				case 0:
 					HandleEvent(set.OnEnter, activator);
@@ -805,8 +894,7 @@ void TestTriggers(int x, int y, int z, FloorInfo* floor, VolumeActivator activat
 		default:
 			break;
 		}
-
-	} while (!(trigger & END_BIT));
+	}
 
 	if (cameraItem && (Camera.type == CameraType::Fixed || Camera.type == CameraType::Heavy))
 		Camera.item = cameraItem;
@@ -875,7 +963,7 @@ void ProcessSectorFlags(ItemInfo* item)
 		}
 		else if (Objects[item->ObjectNumber].intelligent && item->HitPoints != NOT_TARGETABLE)
 		{
-			if (block->Material == MaterialType::Water || TestEnvironment(RoomEnvFlags::ENV_FLAG_WATER, block->Room))
+			if (block->Material == MaterialType::Water || TestEnvironment(RoomEnvFlags::ENV_FLAG_WATER, block->GetRoomNumber()))
 				DoDamage(item, INT_MAX); // TODO: Implement correct rapids behaviour for other objects!
 			else
 				ItemBurn(item);
@@ -15,6 +15,7 @@ constexpr auto FUNCTION_BITS = 0x001F;
 constexpr auto CODE_BITS	 = 0x3E00;
 constexpr auto END_BIT		 = 0x8000;
 constexpr auto TRIGGERED	 = 0x0020;
+constexpr auto NO_TRIGGER	 = -1;
 
 enum TRIGGER_TYPES
 {
@@ -57,6 +58,25 @@ enum TRIGOBJECTS_TYPES
 	TO_LUAEVENT
 };
 
+// Single record of trigger action list, decoded from floordata at level load.
+struct TriggerAction
+{
+	int	  Type	= TO_OBJECT; // TRIGOBJECTS_TYPES.
+	short Value = 0;
+	short Extra = 0; // Second word of camera, flyby and Lua event records.
+};
+
+// Trigger decoded from floordata at level load. Actions are stored contiguously in LEVEL::TriggerActions.
+struct TriggerInfo
+{
+	int	  Type	= TRIGGER_TYPES::TRIGGER;
+	short Flags = 0;
+	short Timer = 0;
+
+	int FirstAction = 0;
+	int ActionCount = 0;
+};
+
 extern int TriggerTimer;
 extern int KeyTriggerActive;
 
@@ -65,10 +85,12 @@ int GetSwitchTrigger(ItemInfo* item, short* itemNumbersPtr, int attatchedToSwitc
 int SwitchTrigger(short itemNumber, short timer);
 int KeyTrigger(short itemNumber);
 bool PickupTrigger(short itemNumber);
-void RefreshCamera(short type, short* data);
+void RefreshCamera(const TriggerInfo& trigger);
 int TriggerActive(ItemInfo* item);
-short* GetTriggerIndex(FloorInfo* floor, int x, int y, int z);
-short* GetTriggerIndex(ItemInfo* item);
+const TriggerInfo* GetTrigger(FloorInfo* floor, int x, int y, int z);
+const TriggerInfo* GetTrigger(ItemInfo* item);
+const TriggerAction& GetTriggerAction(const TriggerInfo& trigger, int index);
+void CompileTriggers(const std::vector<short>& floorData);
 void TestTriggers(int x, int y, int z, short roomNumber, bool heavy, int heavyFlags = 0);
 void TestTriggers(ItemInfo* item, bool isHeavy, int heavyFlags = 0);
 void ProcessSectorFlags(ItemInfo* item);
@@ -1,61 +1,144 @@
 #include "framework.h"
 #include "Game/debug/debug.h"
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
 #include <spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+using namespace std::chrono;
+
+// Async queue size in info messages. When full, oldest messages are overwritten instead of blocking game thread.
+constexpr auto LOG_QUEUE_SIZE		 = 8192;
+constexpr auto LOG_FLUSH_INTERVAL	 = seconds(1);
+constexpr auto LOG_REPEAT_INTERVAL	 = milliseconds(1000);
+constexpr auto LOG_REPEAT_TABLE_SIZE = 1024;
+
+struct LogRepeatEntry
+{
+	steady_clock::time_point LastTime   = {};
+	unsigned int			 Suppressed = 0;
+};
+
+static std::shared_ptr<spdlog::logger> Logger		= nullptr; // Info messages, written on background thread.
+static std::shared_ptr<spdlog::logger> UrgentLogger = nullptr; // Warnings and errors, written and flushed by caller.
+static std::unordered_map<size_t, LogRepeatEntry> RepeatTable = {};
+static std::mutex RepeatMutex = {};
+
 void InitTENLog(const std::string& logDirContainingDir)
 {
 	// "true" means create new log file each time game is run.
 	auto logPath = logDirContainingDir + "Logs/TENLog.txt";
 	auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logPath, true);
 
-	std::shared_ptr<spdlog::logger> logger;
-
 	// Set file and console log targets.
 	auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-	logger = std::make_shared<spdlog::logger>(std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink });
-	
-	spdlog::initialize_logger(logger);
-    logger->set_level(spdlog::level::info);
-	logger->flush_on(spdlog::level::info);
-	logger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
+
+	// Formatting and sink writes are done on a single background thread.
+	spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+	Logger = std::make_shared<spdlog::async_logger>(
+		std::string{ "multi_sink" }, spdlog::sinks_init_list{ fileSink, consoleSink },
+		spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+
+	spdlog::initialize_logger(Logger);
+	Logger->set_level(spdlog::level::info);
+	Logger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
+
+	// Warnings and errors bypass the queue, so they are on disk before TENLog returns and are never overwritten.
+	// They may therefore appear ahead of info messages which are still queued.
+	UrgentLogger = std::make_shared<spdlog::logger>(std::string{ "multi_sink_urgent" }, spdlog::sinks_init_list{ fileSink, consoleSink });
+	spdlog::initialize_logger(UrgentLogger);
+	UrgentLogger->set_level(spdlog::level::warn);
+	UrgentLogger->set_pattern("[%Y-%b-%d %T] [%^%l%$] %v");
+	UrgentLogger->flush_on(spdlog::level::warn);
+
+	// Info messages are flushed periodically.
+	spdlog::flush_every(LOG_FLUSH_INTERVAL);
 }
 
-void TENLog(std::string_view str, LogLevel level, LogConfig config, bool allowSpam)
+// Returns number of suppressed repeats of message to report, or -1 if message should be dropped.
+// Key is message text and call site, so distinct messages from same place are never dropped.
+// Call site is hashed by file name contents, since same file may have several name literals.
+static int TestLogRepeat(std::string_view str, const char* file, int line)
 {
-	static std::string lastString = {};
+	auto hasher = std::hash<std::string_view>{};
+	auto key = (((hasher(file != nullptr ? file : "") * 31) + line) * 31) + hasher(str);
+	auto now = steady_clock::now();
 
-	if (lastString == str && !allowSpam)
-		return;
+	std::lock_guard<std::mutex> lock(RepeatMutex);
+
+	// Don't let table grow indefinitely if scripts log lots of unique strings.
+	if (RepeatTable.size() >= LOG_REPEAT_TABLE_SIZE && RepeatTable.find(key) == RepeatTable.end())
+		RepeatTable.clear();
+
+	auto& entry = RepeatTable[key];
+	if (entry.LastTime != steady_clock::time_point{} && (now - entry.LastTime) < LOG_REPEAT_INTERVAL)
+	{
+		entry.Suppressed++;
+		return -1;
+	}
 
+	int suppressed = entry.Suppressed;
+	entry.LastTime = now;
+	entry.Suppressed = 0;
+	return suppressed;
+}
+
+void TENLog(std::string_view str, LogLevel level, LogConfig config, bool allowSpam, const char* file, int line)
+{
 	if constexpr (!DebugBuild)
 	{
 		if (LogConfig::Debug == config)
 			return;
 	}
 
-	auto logger = spdlog::get("multi_sink");
+	if (Logger == nullptr || UrgentLogger == nullptr)
+		return;
+
+	// Errors are always written.
+	int suppressed = 0;
+	if (!allowSpam && level != LogLevel::Error)
+	{
+		suppressed = TestLogRepeat(str, file, line);
+		if (suppressed < 0)
+			return;
+	}
+
+	auto spdLevel = spdlog::level::info;
 	switch (level)
 	{
 	case LogLevel::Error:
-		logger->error(str);
+		spdLevel = spdlog::level::err;
 		break;
+
 	case LogLevel::Warning:
-		logger->warn(str);
+		spdLevel = spdlog::level::warn;
 		break;
+
 	case LogLevel::Info:
-		logger->info(str);
+		spdLevel = spdlog::level::info;
 		break;
 	}
 
-	logger->flush();
-
-	lastString = std::string(str);
+	auto& logger = (spdLevel >= spdlog::level::warn) ? UrgentLogger : Logger;
+	if (suppressed > 0)
+		logger->log(spdLevel, "{} ({} repeats suppressed)", str, suppressed);
+	else
+		logger->log(spdLevel, str);
 }
 
 void ShutdownTENLog()
 {
+	if (Logger != nullptr)
+		Logger->flush();
+
+	if (UrgentLogger != nullptr)
+		UrgentLogger->flush();
+
+	Logger = nullptr;
+	UrgentLogger = nullptr;
 	spdlog::shutdown();
 }
@@ -22,7 +22,10 @@ enum class LogConfig
 	All
 };
 
-void TENLog(std::string_view str, LogLevel level = LogLevel::Info, LogConfig config = LogConfig::All, bool allowSpam = false);
+// Repeats of same message from same call site are rate limited unless spam is allowed. Errors are never limited.
+// Call site defaults to caller's file and line.
+void TENLog(std::string_view str, LogLevel level = LogLevel::Info, LogConfig config = LogConfig::All, bool allowSpam = false,
+			const char* file = __builtin_FILE(), int line = __builtin_LINE());
 void ShutdownTENLog();
 void InitTENLog(const std::string& logDirContainingDir);
 
@@ -32,13 +35,13 @@ public:
 	using std::runtime_error::runtime_error;
 };
 
-inline void assertion(const bool& expr, const char* msg) 
+inline void assertion(const bool& expr, const char* msg, const char* file = __builtin_FILE(), int line = __builtin_LINE())
 {
 	if constexpr (DebugBuild) 
 	{
 		if (!expr)
 		{
-			TENLog(msg, LogLevel::Error);
+			TENLog(msg, LogLevel::Error, LogConfig::All, false, file, line);
 			throw std::runtime_error(msg);
 		}
 	}
@@ -0,0 +1,296 @@
+#include "framework.h"
+#include "Game/effects/HairSolver.h"
+
+#include <chrono>
+#include <functional>
+
+#include "Math/Math.h"
+
+using namespace TEN::Math;
+
+namespace TEN::Effects::Hair
+{
+	int HairSolver::GetStrandCount() const
+	{
+		return (int)m_strands.size();
+	}
+
+	int HairSolver::GetSegmentCount() const
+	{
+		return m_segmentCount;
+	}
+
+	bool HairSolver::IsStrandEnabled(int strandIndex) const
+	{
+		return m_strands[strandIndex].IsEnabled;
+	}
+
+	const Vector3* HairSolver::GetPositions(int strandIndex) const
+	{
+		return &m_positions[strandIndex * m_segmentCount];
+	}
+
+	const Quaternion* HairSolver::GetOrientations(int strandIndex) const
+	{
+		return &m_orientations[strandIndex * m_segmentCount];
+	}
+
+	void HairSolver::SetStrandEnabled(int strandIndex, bool isEnabled)
+	{
+		m_strands[strandIndex].IsEnabled = isEnabled;
+	}
+
+	// Strand has one more segment than joint offsets, as first segment sits at base.
+	void HairSolver::Initialize(int strandCount, const std::vector<Vector3>& jointOffsets, const Quaternion& orient)
+	{
+		m_jointOffsets = jointOffsets;
+		m_segmentCount = (int)jointOffsets.size() + 1;
+
+		m_strands.assign(strandCount, Strand{});
+		m_positions.assign(strandCount * m_segmentCount, Vector3::Zero);
+		m_velocities.assign(strandCount * m_segmentCount, Vector3::Zero);
+		m_orientations.assign(strandCount * m_segmentCount, orient);
+	}
+
+	void HairSolver::Reset()
+	{
+		for (auto& strand : m_strands)
+			strand.IsInitialized = false;
+	}
+
+	// Inputs are per strand; probes and segments are laid out same way, strand after strand.
+	void HairSolver::Step(const std::vector<HairStrandInput>& inputs, const std::vector<HairSegmentProbe>& probes, const std::vector<BoundingSphere>& spheres)
+	{
+		for (int i = 0; i < m_strands.size(); i++)
+		{
+			if (!m_strands[i].IsEnabled)
+				continue;
+
+			for (int step = 0; step < inputs[i].StepCount; step++)
+				StepStrand(i, inputs[i], &probes[i * m_segmentCount], spheres);
+		}
+	}
+
+	void HairSolver::PlaceStrand(int strandIndex, const Vector3& basePos)
+	{
+		auto* positions = &m_positions[strandIndex * m_segmentCount];
+		const auto* orientations = &m_orientations[strandIndex * m_segmentCount];
+
+		positions[0] = basePos;
+		for (int i = 0; i < (m_segmentCount - 1); i++)
+			positions[i + 1] = positions[i] + Vector3::Transform(m_jointOffsets[i], orientations[i]);
+	}
+
+	void HairSolver::StepStrand(int strandIndex, const HairStrandInput& input, const HairSegmentProbe* probes, const std::vector<BoundingSphere>& spheres)
+	{
+		auto& strand = m_strands[strandIndex];
+
+		if (!strand.IsInitialized)
+		{
+			PlaceStrand(strandIndex, input.BasePosition);
+			strand.IsInitialized = true;
+			return;
+		}
+
+		auto* positions = &m_positions[strandIndex * m_segmentCount];
+		auto* velocities = &m_velocities[strandIndex * m_segmentCount];
+		auto* orientations = &m_orientations[strandIndex * m_segmentCount];
+
+		positions[0] = input.BasePosition;
+
+		for (int i = 1; i < m_segmentCount; i++)
+		{
+			auto& pos = positions[i];
+			const auto& probe = probes[i];
+
+			auto prevPos = pos;
+			pos += velocities[i] * VELOCITY_COEFF;
+
+			// Land collision.
+			if (input.IsOnLand)
+			{
+				// Let wind affect position.
+				if (probe.IsWindy)
+					pos += input.Wind * WIND_COEFF;
+
+				// Apply gravity.
+				pos.y += GRAVITY;
+
+				// Float on water surface.
+				if (input.WaterHeight != NO_HEIGHT && pos.y > input.WaterHeight)
+				{
+					pos.y = input.WaterHeight;
+				}
+				// Avoid clipping through floor.
+				else if (probe.FloorHeight > positions[0].y && pos.y > probe.FloorHeight)
+				{
+					pos = prevPos;
+				}
+			}
+			// Water collision.
+			else
+			{
+				if (pos.y < input.WaterHeight)
+				{
+					pos.y = input.WaterHeight;
+				}
+				else if (pos.y > probe.FloorHeight)
+				{
+					pos.y = probe.FloorHeight;
+				}
+			}
+
+			// Push segment out of spheres.
+			for (const auto& sphere : spheres)
+			{
+				auto direction = pos - sphere.Center;
+
+				float distance = direction.Length();
+				if (distance < sphere.Radius)
+				{
+					// Avoid division by zero.
+					if (distance == 0.0f)
+						distance = 1.0f;
+
+					pos = sphere.Center + (direction * (sphere.Radius / distance));
+				}
+			}
+
+			orientations[i - 1] = GetSegmentOrientation(positions[i - 1], pos, input.TwistAngle);
+
+			// NOTE: Last segment reuses previous joint offset.
+			int jointIndex = (i == (m_segmentCount - 1)) ? std::max(i - 2, 0) : (i - 1);
+
+			pos = positions[i - 1] + Vector3::Transform(m_jointOffsets[jointIndex], orientations[i - 1]);
+			velocities[i] = (pos - prevPos) * VELOCITY_DAMPING;
+		}
+	}
+
+	Quaternion HairSolver::GetSegmentOrientation(const Vector3& origin, const Vector3& target, short twistAngle) const
+	{
+		// Calculate absolute orientation.
+		auto absDirection = target - origin;
+		absDirection.Normalize();
+		auto absOrient = Geometry::ConvertDirectionToQuat(absDirection);
+
+		// Calculate relative twist rotation.
+		// TODO: Find accurate twist angle based on relation between absOrient and base orientation.
+		auto twistAxisAngle = AxisAngle(absDirection, twistAngle);
+		auto twistRot = twistAxisAngle.ToQuaternion();
+
+		// Return ideal orientation.
+		return (absOrient * twistRot);
+	}
+
+	// Steps single strand hanging from fixed base in different environments without level, and checks segment lengths
+	// are kept, strand settles where environment allows, and disabled strands and step count behave. Logs time per step.
+	bool TestHairSolver()
+	{
+		constexpr auto JOINT_COUNT			= 6;
+		constexpr auto SEGMENT_LENGTH		= 40.0f;
+		constexpr auto STEP_COUNT			= 300;
+		constexpr auto TOLERANCE			= 1.0f;
+		constexpr auto BENCHMARK_STEP_COUNT = 100000;
+
+		const auto jointOffsets = std::vector<Vector3>(JOINT_COUNT, Vector3(0.0f, 0.0f, SEGMENT_LENGTH));
+
+		// Strand 0 is simulated, strand 1 stays disabled.
+		auto simulate = [&](const HairStrandInput& input, const HairSegmentProbe& probe, const std::vector<BoundingSphere>& spheres, int stepCount)
+		{
+			auto solver = HairSolver();
+			solver.Initialize(2, jointOffsets, Quaternion::Identity);
+			solver.SetStrandEnabled(0, true);
+
+			auto inputs = std::vector<HairStrandInput>(2, input);
+			auto probes = std::vector<HairSegmentProbe>(2 * solver.GetSegmentCount(), probe);
+			for (int i = 0; i < stepCount; i++)
+				solver.Step(inputs, probes, spheres);
+
+			return solver;
+		};
+
+		bool isPassed = true;
+		auto check = [&](bool condition, const std::string& message)
+		{
+			if (!condition)
+			{
+				TENLog("Hair solver: " + message, LogLevel::Error);
+				isPassed = false;
+			}
+		};
+
+		auto checkSegments = [&](const HairSolver& solver, const std::string& name, const std::function<bool(const Vector3&)>& isValid)
+		{
+			const auto* positions = solver.GetPositions(0);
+			for (int i = 1; i < solver.GetSegmentCount(); i++)
+			{
+				check(abs(Vector3::Distance(positions[i - 1], positions[i]) - SEGMENT_LENGTH) <= TOLERANCE, name + ": segment " + std::to_string(i) + " changed length.");
+				check(isValid(positions[i]), name + ": segment " + std::to_string(i) + " is out of bounds.");
+			}
+
+			const auto* disabledPositions = solver.GetPositions(1);
+			for (int i = 0; i < solver.GetSegmentCount(); i++)
+				check(disabledPositions[i] == Vector3::Zero, name + ": disabled strand moved.");
+		};
+
+		auto landInput = HairStrandInput{};
+		landInput.WaterHeight = NO_HEIGHT;
+
+		auto farFloorProbe = HairSegmentProbe{ BLOCK(8), false };
+		float strandLength = SEGMENT_LENGTH * JOINT_COUNT;
+
+		// Hangs straight down under gravity.
+		auto solver = simulate(landInput, farFloorProbe, {}, STEP_COUNT);
+		checkSegments(solver, "Hanging", [&](const Vector3& pos) { return (pos.y > 0.0f); });
+		check(solver.GetPositions(0)[JOINT_COUNT].y >= (strandLength - TOLERANCE * JOINT_COUNT), "Hanging: strand didn't settle straight down.");
+
+		// Rests on floor below base.
+		constexpr auto FLOOR_HEIGHT = 100;
+		solver = simulate(landInput, HairSegmentProbe{ FLOOR_HEIGHT, false }, {}, STEP_COUNT);
+		checkSegments(solver, "Floor", [&](const Vector3& pos) { return (pos.y <= (FLOOR_HEIGHT + TOLERANCE)); });
+
+		// Floats on water surface below base.
+		constexpr auto WATER_HEIGHT = 60;
+		auto waterInput = landInput;
+		waterInput.WaterHeight = WATER_HEIGHT;
+		solver = simulate(waterInput, farFloorProbe, {}, STEP_COUNT);
+		checkSegments(solver, "Water surface", [&](const Vector3& pos) { return (pos.y <= (WATER_HEIGHT + TOLERANCE)); });
+
+		// Stays between surface and floor under water.
+		auto underwaterInput = landInput;
+		underwaterInput.IsOnLand = false;
+		underwaterInput.WaterHeight = -BLOCK(1);
+		solver = simulate(underwaterInput, HairSegmentProbe{ FLOOR_HEIGHT, false }, {}, STEP_COUNT);
+		checkSegments(solver, "Underwater", [&](const Vector3& pos) { return (pos.y >= (underwaterInput.WaterHeight - TOLERANCE) && pos.y <= (FLOOR_HEIGHT + TOLERANCE)); });
+
+		// Drapes around sphere below base. Length constraint is applied after push out, so segments may sink in slightly.
+		auto sphere = BoundingSphere(Vector3(0.0f, 120.0f, 0.0f), 80.0f);
+		solver = simulate(landInput, farFloorProbe, { sphere }, STEP_COUNT);
+		checkSegments(solver, "Sphere", [&](const Vector3& pos) { return (Vector3::Distance(pos, sphere.Center) >= (sphere.Radius * 0.9f)); });
+
+		// Blown aside by wind.
+		auto windInput = landInput;
+		windInput.Wind = Vector3(10.0f, 0.0f, 0.0f);
+		solver = simulate(windInput, HairSegmentProbe{ BLOCK(8), true }, {}, STEP_COUNT);
+		checkSegments(solver, "Wind", [](const Vector3& pos) { return true; });
+		check(solver.GetPositions(0)[JOINT_COUNT].x > SEGMENT_LENGTH, "Wind: strand wasn't blown aside.");
+
+		// Two substeps per call match two calls of one substep.
+		auto doubleStepInput = landInput;
+		doubleStepInput.StepCount = 2;
+		auto solver0 = simulate(doubleStepInput, farFloorProbe, { sphere }, STEP_COUNT / 2);
+		auto solver1 = simulate(landInput, farFloorProbe, { sphere }, STEP_COUNT);
+		for (int i = 0; i < solver0.GetSegmentCount(); i++)
+			check(solver0.GetPositions(0)[i] == solver1.GetPositions(0)[i], "Step count: substeps diverged from separate steps.");
+
+		// Time stepping with collision sphere, as for player's head and shoulders.
+		auto startTime = std::chrono::high_resolution_clock::now();
+		solver = simulate(landInput, HairSegmentProbe{ FLOOR_HEIGHT, false }, { sphere, sphere, sphere, sphere, sphere }, BENCHMARK_STEP_COUNT);
+		auto stepTime = std::chrono::high_resolution_clock::now() - startTime;
+
+		TENLog("Hair solver: " + std::to_string(std::chrono::duration<double, std::micro>(stepTime).count() / BENCHMARK_STEP_COUNT) +
+			   " us per step of " + std::to_string(JOINT_COUNT + 1) + " segment strand against 5 spheres.", LogLevel::Info);
+
+		return isPassed;
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+namespace TEN::Effects::Hair
+{
+	// Per-frame input of single strand.
+	struct HairStrandInput
+	{
+		Vector3 BasePosition = Vector3::Zero;
+		short	TwistAngle	 = 0; // Rotation of segments around their own direction.
+		int		StepCount	 = 1;
+
+		bool	IsOnLand	= true;
+		int		WaterHeight = 0;
+		Vector3 Wind		= Vector3::Zero; // Applied on land to segments with IsWindy probe.
+	};
+
+	// Environment at segment position, sampled by caller before step.
+	struct HairSegmentProbe
+	{
+		int	 FloorHeight = 0;
+		bool IsWindy	 = false;
+	};
+
+	// Strand solver which only works on its inputs, so it doesn't need renderer or level to run.
+	// Segments of all strands are stored in packed arrays, strand after strand.
+	class HairSolver
+	{
+	private:
+		// Constants
+		static constexpr auto GRAVITY		   = 10.0f;
+		static constexpr auto WIND_COEFF	   = 2.0f;
+		static constexpr auto VELOCITY_COEFF   = 0.75f;
+		static constexpr auto VELOCITY_DAMPING = 0.9f;
+
+		struct Strand
+		{
+			bool IsEnabled	   = false;
+			bool IsInitialized = false;
+		};
+
+		std::vector<Strand>		m_strands	   = {};
+		std::vector<Vector3>	m_jointOffsets = {}; // Segment length offsets, shared by all strands.
+		std::vector<Vector3>	m_positions	   = {};
+		std::vector<Vector3>	m_velocities   = {};
+		std::vector<Quaternion> m_orientations = {};
+		int						m_segmentCount = 0;
+
+	public:
+		// Getters
+		int				  GetStrandCount() const;
+		int				  GetSegmentCount() const;
+		bool			  IsStrandEnabled(int strandIndex) const;
+		const Vector3*	  GetPositions(int strandIndex) const;
+		const Quaternion* GetOrientations(int strandIndex) const;
+
+		// Setters
+		void SetStrandEnabled(int strandIndex, bool isEnabled);
+
+		// Utilities
+		void Initialize(int strandCount, const std::vector<Vector3>& jointOffsets, const Quaternion& orient);
+		void Reset();
+		void Step(const std::vector<HairStrandInput>& inputs, const std::vector<HairSegmentProbe>& probes, const std::vector<BoundingSphere>& spheres);
+
+	private:
+		// Helpers
+		void PlaceStrand(int strandIndex, const Vector3& basePos);
+		void StepStrand(int strandIndex, const HairStrandInput& input, const HairSegmentProbe* probes, const std::vector<BoundingSphere>& spheres);
+		Quaternion GetSegmentOrientation(const Vector3& origin, const Vector3& target, short twistAngle) const;
+	};
+
+	bool TestHairSolver();
+}
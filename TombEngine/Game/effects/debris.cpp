@@ -1,23 +1,55 @@
 #include "framework.h"
 #include "Game/effects/debris.h"
 
+#include <chrono>
+
 #include "Game/collision/collide_room.h"
+#include "Game/collision/floordata.h"
 #include "Game/effects/tomb4fx.h"
 #include "Game/Setup.h"
 #include "Specific/level.h"
 #include "Math/Random.h"
 #include "Math/Math.h"
 
-using std::vector;
+using namespace TEN::Collision::Floordata;
 using namespace TEN::Renderer;
 using namespace TEN::Math::Random;
 
+constexpr auto DEBRIS_TERMINAL_VELOCITY = 1024.0f;
+constexpr auto DEBRIS_GRAVITY			= 7.0f;
+constexpr auto DEBRIS_LINEAR_DRAG		= 0.99f;
+constexpr auto DEBRIS_RESTITUTION		= 0.6f;
+constexpr auto DEBRIS_FRICTION			= 0.6f;
+constexpr auto DEBRIS_BOUNCE_COUNT_MAX	= 3;
+
+constexpr auto DEBRIS_SECTOR_CACHE_SIZE = 256;
+
+// Polygon vertex order of shatter fragments.
+constexpr int TRIANGLE_INDICES[3] = { 0, 1, 2 };
+constexpr int QUAD_INDICES[6]	  = { 0, 1, 3, 2, 3, 1 };
+
+// Sector lookups of current update, shared by all fragments with same room at same absolute sector.
+struct DebrisSectorCacheEntry
+{
+	int			 RoomNumber		= NO_ROOM;
+	int			 SectorX		= 0;
+	int			 SectorZ		= 0;
+	unsigned int Frame			= 0;
+	FloorInfo*	 Sector			= nullptr;
+	int			 SideRoomNumber = NO_ROOM; // Room which owns sector after side portal traversal.
+};
+
 ShatterImpactInfo ShatterImpactData;
 SHATTER_ITEM ShatterItem;
 short SmashedMeshCount;
 MESH_INFO* SmashedMesh[32];
 short SmashedMeshRoom[32];
-vector<DebrisFragment> DebrisFragments = vector<DebrisFragment>(MAX_DEBRIS);
+DebrisPool Debris;
+
+static std::vector<ShatterTemplate> ShatterTemplates = {}; // Indexed by g_Level.Meshes index.
+
+static std::array<DebrisSectorCacheEntry, DEBRIS_SECTOR_CACHE_SIZE> DebrisSectorCache = {};
+static unsigned int DebrisSectorCacheFrame = 0;
 
 bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits)
 {
@@ -47,15 +79,98 @@ bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits)
 	return false;
 }
 
-DebrisFragment* GetFreeDebrisFragment()
+// Moves last active fragment into freed slot to keep pool dense.
+static void RemoveDebrisFragment(DebrisPool& pool, int index)
+{
+	int lastIndex = --pool.Count;
+	if (index == lastIndex)
+		return;
+
+	pool.Positions[index] = pool.Positions[lastIndex];
+	pool.Velocities[index] = pool.Velocities[lastIndex];
+	pool.Orientations[index] = pool.Orientations[lastIndex];
+	pool.AngularVelocities[index] = pool.AngularVelocities[lastIndex];
+	pool.AngularDrags[index] = pool.AngularDrags[lastIndex];
+	pool.RoomNumbers[index] = pool.RoomNumbers[lastIndex];
+	pool.NumBounces[index] = pool.NumBounces[lastIndex];
+	pool.Meshes[index] = pool.Meshes[lastIndex];
+	pool.Colors[index] = pool.Colors[lastIndex];
+	pool.LightModes[index] = pool.LightModes[lastIndex];
+	pool.IsStatic[index] = pool.IsStatic[lastIndex];
+}
+
+static void IntegrateDebris(DebrisPool& pool)
 {
-	for (auto& frag : DebrisFragments) 
+	for (int i = 0; i < pool.Count; i++)
 	{
-		if (!frag.active)
-			return &frag;
+		auto& velocity = pool.Velocities[i];
+		auto& angularVelocity = pool.AngularVelocities[i];
+
+		velocity *= DEBRIS_LINEAR_DRAG;
+		velocity.y += DEBRIS_GRAVITY;
+		velocity = XMVector3ClampLength(velocity, 0, DEBRIS_TERMINAL_VELOCITY);
+		pool.Orientations[i] *= Quaternion::CreateFromYawPitchRoll(angularVelocity.x, angularVelocity.y, angularVelocity.z);
+		pool.Positions[i] += velocity;
+		angularVelocity *= pool.AngularDrags[i];
 	}
+}
+
+static const ShatterTemplate& GetShatterTemplate(int meshIndex)
+{
+	if (ShatterTemplates.size() != g_Level.Meshes.size())
+		ShatterTemplates.resize(g_Level.Meshes.size());
+
+	auto& shatterTemplate = ShatterTemplates[meshIndex];
+	if (shatterTemplate.IsBuilt)
+		return shatterTemplate;
+
+	const auto& mesh = g_Level.Meshes[meshIndex];
+	const auto& arena = g_Level.Polygons;
+
+	for (const auto& renderBucket : mesh.buckets)
+	{
+		for (const auto& poly : renderBucket.polygons)
+		{
+			const int* polyIndices = &arena.Indices[poly.baseIndex];
+			const Vector2* polyUVs = &arena.TextureCoordinates[poly.baseIndex];
+			const Vector3* polyNormals = &arena.Normals[poly.baseIndex];
+
+			bool isQuad = (poly.shape == SHAPE_RECTANGLE);
+			const int* indices = isQuad ? QUAD_INDICES : TRIANGLE_INDICES;
+
+			for (int i = 0; i < (isQuad ? 6 : 3); i += 3)
+			{
+				auto fragmentMesh = DebrisMesh{};
+
+				// Take the average of all 3 local positions.
+				auto centroid = Vector3::Zero;
+				for (int j = 0; j < 3; j++)
+				{
+					int vertex = indices[i + j];
+					const auto& color = mesh.colors[polyIndices[vertex]];
+
+					fragmentMesh.Positions[j] = mesh.positions[polyIndices[vertex]];
+					fragmentMesh.TextureCoordinates[j] = polyUVs[vertex];
+					fragmentMesh.Normals[j] = polyNormals[vertex];
+					fragmentMesh.Colors[j] = Vector4(color.x, color.y, color.z, 1.0f);
+					centroid += fragmentMesh.Positions[j];
+				}
+
+				centroid /= 3;
+				for (auto& pos : fragmentMesh.Positions)
+					pos -= centroid;
+
+				fragmentMesh.blendMode = renderBucket.blendMode;
+				fragmentMesh.tex = renderBucket.texture;
 
-	return nullptr;
+				shatterTemplate.Centroids.push_back(centroid);
+				shatterTemplate.Meshes.push_back(fragmentMesh);
+			}
+		}
+	}
+
+	shatterTemplate.IsBuilt = true;
+	return shatterTemplate;
 }
 
 void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumber, int noZXVel)
@@ -91,100 +206,39 @@ void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumbe
 		scale = 1.0f;
 	}
 
-	auto fragmentsMesh = &g_Level.Meshes[meshIndex];
+	const auto& shatterTemplate = GetShatterTemplate(meshIndex);
+	auto rotMatrix = Matrix::CreateFromYawPitchRoll(TO_RAD(yRot), 0, 0);
+	auto color = isStatic ? mesh->color : item->color;
+	auto lightMode = g_Level.Meshes[meshIndex].lightMode;
 
-	for (auto& renderBucket : fragmentsMesh->buckets)
+	int firstIndex = Debris.Count;
+	int count = std::min((int)shatterTemplate.Meshes.size(), MAX_DEBRIS - firstIndex);
+	Debris.Count += count;
+
+	std::copy_n(shatterTemplate.Meshes.begin(), count, Debris.Meshes.begin() + firstIndex);
+	std::fill_n(Debris.Colors.begin() + firstIndex, count, color);
+	std::fill_n(Debris.LightModes.begin() + firstIndex, count, lightMode);
+	std::fill_n(Debris.IsStatic.begin() + firstIndex, count, isStatic);
+	std::fill_n(Debris.Orientations.begin() + firstIndex, count, Quaternion::Identity);
+	std::fill_n(Debris.RoomNumbers.begin() + firstIndex, count, roomNumber);
+	std::fill_n(Debris.NumBounces.begin() + firstIndex, count, 0);
+
+	for (int i = 0; i < count; i++)
 	{
-		for (int i = 0; i < renderBucket.polygons.size(); i++)
+		int fragmentIndex = firstIndex + i;
+
+		if (scale != 1.0f)
 		{
-			POLYGON* poly = &renderBucket.polygons[i];
-			int indices[6];
+			for (auto& vertexPos : Debris.Meshes[fragmentIndex].Positions)
+				vertexPos *= scale;
+		}
 
-			if (poly->shape == SHAPE_RECTANGLE)
-			{
-				indices[0] = 0;
-				indices[1] = 1;
-				indices[2] = 3;
-				indices[3] = 2;
-				indices[4] = 3;
-				indices[5] = 1;
-			}
-			else
-			{
-				indices[0] = 0;
-				indices[1] = 1;
-				indices[2] = 2;
-				indices[3] = -1;
-				indices[4] = -1;
-				indices[5] = -1;
-			}
+		auto fragmentPos = Vector3::Transform(shatterTemplate.Centroids[i] * scale, rotMatrix) + pos;
 
-			for (int j = 0; j < (poly->shape == SHAPE_RECTANGLE ? 2 : 1); j++)
-			{
-				DebrisFragment* fragment = GetFreeDebrisFragment();
-
-				if (!fragment)
-					break;
-
-				Matrix rotationMatrix = Matrix::CreateFromYawPitchRoll(TO_RAD(yRot), 0, 0);
-
-				Vector3 pos1 = fragmentsMesh->positions[poly->indices[indices[j * 3 + 0]]] * scale;
-				Vector3 pos2 = fragmentsMesh->positions[poly->indices[indices[j * 3 + 1]]] * scale;
-				Vector3 pos3 = fragmentsMesh->positions[poly->indices[indices[j * 3 + 2]]] * scale;
-
-				Vector2 uv1 = poly->textureCoordinates[indices[j * 3 + 0]];
-				Vector2 uv2 = poly->textureCoordinates[indices[j * 3 + 1]];
-				Vector2 uv3 = poly->textureCoordinates[indices[j * 3 + 2]];
-
-				Vector3 normal1 = poly->normals[indices[j * 3 + 0]];
-				Vector3 normal2 = poly->normals[indices[j * 3 + 1]];
-				Vector3 normal3 = poly->normals[indices[j * 3 + 2]];
-
-				Vector3 color1 = fragmentsMesh->colors[poly->indices[indices[j * 3 + 0]]];
-				Vector3 color2 = fragmentsMesh->colors[poly->indices[indices[j * 3 + 1]]];
-				Vector3 color3 = fragmentsMesh->colors[poly->indices[indices[j * 3 + 2]]];
-
-				//Take the average of all 3 local positions
-				Vector3 localPos = (pos1 + pos2 + pos3) / 3;
-				Vector3 worldPos = Vector3::Transform(localPos, rotationMatrix);
-
-				fragment->worldPosition = worldPos + pos;
-
-				fragment->mesh.Positions[0] = pos1 - localPos;
-				fragment->mesh.Positions[1] = pos2 - localPos;
-				fragment->mesh.Positions[2] = pos3 - localPos;
-
-				fragment->mesh.TextureCoordinates[0] = uv1;
-				fragment->mesh.TextureCoordinates[1] = uv2;
-				fragment->mesh.TextureCoordinates[2] = uv3;
-
-				fragment->mesh.Normals[0] = normal1;
-				fragment->mesh.Normals[1] = normal2;
-				fragment->mesh.Normals[2] = normal3;
-
-				fragment->mesh.Colors[0] = Vector4(color1.x, color1.y, color1.z, 1.0f);
-				fragment->mesh.Colors[1] = Vector4(color2.x, color2.y, color2.z, 1.0f);
-				fragment->mesh.Colors[2] = Vector4(color3.x, color3.y, color3.z, 1.0f);
-
-				fragment->mesh.blendMode = renderBucket.blendMode;
-				fragment->mesh.tex = renderBucket.texture;
-
-				fragment->isStatic = isStatic;
-				fragment->active = true;
-				fragment->terminalVelocity = 1024;
-				fragment->gravity = Vector3(0, 7, 0);
-				fragment->restitution = 0.6f;
-				fragment->friction = 0.6f;
-				fragment->linearDrag = .99f;
-				fragment->angularVelocity = Vector3(GenerateFloat(-1, 1) * 0.39, GenerateFloat(-1, 1) * 0.39, GenerateFloat(-1, 1) * 0.39);
-				fragment->angularDrag = GenerateFloat(0.9f, 0.999f);
-				fragment->velocity = CalculateFragmentImpactVelocity(fragment->worldPosition, ShatterImpactData.impactDirection, ShatterImpactData.impactLocation);
-				fragment->roomNumber = roomNumber;
-				fragment->numBounces = 0;
-				fragment->color = isStatic ? mesh->color : item->color;
-				fragment->lightMode = fragmentsMesh->lightMode;
-			}
-		}
+		Debris.Positions[fragmentIndex] = fragmentPos;
+		Debris.AngularVelocities[fragmentIndex] = Vector3(GenerateFloat(-1, 1) * 0.39, GenerateFloat(-1, 1) * 0.39, GenerateFloat(-1, 1) * 0.39);
+		Debris.AngularDrags[fragmentIndex] = GenerateFloat(0.9f, 0.999f);
+		Debris.Velocities[fragmentIndex] = CalculateFragmentImpactVelocity(fragmentPos, ShatterImpactData.impactDirection, ShatterImpactData.impactLocation);
 	}
 }
 
@@ -204,58 +258,207 @@ Vector3 CalculateFragmentImpactVelocity(const Vector3& fragmentWorldPosition, co
 
 void DisableDebris()
 {
-	for (auto& deb : DebrisFragments)
+	Debris.Count = 0;
+}
+
+void ClearShatterTemplates()
+{
+	ShatterTemplates.clear();
+}
+
+// Cache is keyed by absolute sector coordinates, since GetFloorSide() resolves sector from unclamped position.
+static const DebrisSectorCacheEntry& GetDebrisSector(int roomNumber, int x, int z)
+{
+	int sectorX = x / BLOCK(1);
+	int sectorZ = z / BLOCK(1);
+
+	unsigned int hash = (unsigned int)((roomNumber * 31 + sectorX) * 31 + sectorZ);
+	auto& entry = DebrisSectorCache[hash % DEBRIS_SECTOR_CACHE_SIZE];
+	if (entry.Frame == DebrisSectorCacheFrame && entry.RoomNumber == roomNumber &&
+		entry.SectorX == sectorX && entry.SectorZ == sectorZ)
 	{
-		deb.active = false;
+		return entry;
 	}
+
+	int sideRoomNumber = roomNumber;
+	entry.Sector = &GetFloorSide(roomNumber, x, z, &sideRoomNumber);
+	entry.SideRoomNumber = sideRoomNumber;
+	entry.RoomNumber = roomNumber;
+	entry.SectorX = sectorX;
+	entry.SectorZ = sectorZ;
+	entry.Frame = DebrisSectorCacheFrame;
+	return entry;
+}
+
+// Fragment between floor and ceiling of plain sector which still belongs to its stored room can't change room or bounce.
+// It's what GetFloor() would resolve as well, but without vertical portal and bridge traversal.
+// Fragments which crossed side portal are left to GetFloor(), since their stored room is stale.
+static bool IsDebrisInsideSector(int roomNumber, const Vector3& pos)
+{
+	int x = (int)pos.x;
+	int z = (int)pos.z;
+
+	const auto& entry = GetDebrisSector(roomNumber, x, z);
+	if (entry.SideRoomNumber != roomNumber)
+		return false;
+
+	const auto& sector = *entry.Sector;
+
+	if (!sector.BridgeItemNumbers.empty() || sector.IsWall(x, z))
+		return false;
+
+	return (pos.y >= sector.GetSurfaceHeight(x, z, false) && pos.y <= sector.GetSurfaceHeight(x, z, true));
 }
 
 void UpdateDebris()
 {
-	for (auto& deb : DebrisFragments)
+	if (Debris.Count == 0)
+		return;
+
+	DebrisSectorCacheFrame++;
+	if (DebrisSectorCacheFrame == 0)
 	{
-		if (deb.active)
-		{
-			FloorInfo* floor;
-			short roomNumber;
+		DebrisSectorCache.fill({});
+		DebrisSectorCacheFrame = 1;
+	}
 
-			deb.velocity *= deb.linearDrag;
-			deb.velocity += deb.gravity;
-			deb.velocity = XMVector3ClampLength(deb.velocity, 0, deb.terminalVelocity);
-			deb.rotation *= Quaternion::CreateFromYawPitchRoll(deb.angularVelocity.x, deb.angularVelocity.y, deb.angularVelocity.z);
-			deb.worldPosition += deb.velocity;
-			deb.angularVelocity *= deb.angularDrag;
+	IntegrateDebris(Debris);
 
-			roomNumber = deb.roomNumber;
-			floor = GetFloor(deb.worldPosition.x, deb.worldPosition.y, deb.worldPosition.z, &roomNumber);
+	// Iterate backwards, so fragments swapped in on removal were already updated.
+	for (int i = Debris.Count - 1; i >= 0; i--)
+	{
+		const auto& pos = Debris.Positions[i];
+
+		if (IsDebrisInsideSector(Debris.RoomNumbers[i], pos))
+			continue;
 
-			if (deb.worldPosition.y < floor->GetSurfaceHeight(deb.worldPosition.x, deb.worldPosition.z, false))
+		short roomNumber = Debris.RoomNumbers[i];
+		auto* floor = GetFloor(pos.x, pos.y, pos.z, &roomNumber);
+
+		if (pos.y < floor->GetSurfaceHeight(pos.x, pos.z, false))
+		{
+			auto roomNumberAbove = floor->GetRoomNumberAbove(pos.x, pos.y, pos.z).value_or(NO_ROOM);
+			if (roomNumberAbove != NO_ROOM)
+				Debris.RoomNumbers[i] = roomNumberAbove;
+		}
+
+		if (pos.y > floor->GetSurfaceHeight(pos.x, pos.z, true))
+		{
+			auto roomNumberBelow = floor->GetRoomNumberBelow(pos.x, pos.y, pos.z).value_or(NO_ROOM);
+			if (roomNumberBelow != NO_ROOM)
 			{
-				auto roomNumber = floor->GetRoomNumberAbove(deb.worldPosition.x, deb.worldPosition.y, deb.worldPosition.z).value_or(NO_ROOM);
-				if (roomNumber != NO_ROOM)
-					deb.roomNumber = roomNumber;
+				Debris.RoomNumbers[i] = roomNumberBelow;
+				continue;
 			}
 
-			if (deb.worldPosition.y > floor->GetSurfaceHeight(deb.worldPosition.x, deb.worldPosition.z, true))
+			if (Debris.NumBounces[i] > DEBRIS_BOUNCE_COUNT_MAX)
 			{
-				auto roomNumber = floor->GetRoomNumberBelow(deb.worldPosition.x, deb.worldPosition.y, deb.worldPosition.z).value_or(NO_ROOM);
-				if (roomNumber != NO_ROOM)
-				{
-					deb.roomNumber = roomNumber;
-					continue;
-				}
+				RemoveDebrisFragment(Debris, i);
+				continue;
+			}
 
-				if (deb.numBounces > 3)
-				{
-					deb.active = false;
-					continue;
-				}
-				
-				deb.velocity.y *= -deb.restitution;
-				deb.velocity.x *= deb.friction;
-				deb.velocity.z *= deb.friction;
-				deb.numBounces++;
+			auto& velocity = Debris.Velocities[i];
+			velocity.y *= -DEBRIS_RESTITUTION;
+			velocity.x *= DEBRIS_FRICTION;
+			velocity.z *= DEBRIS_FRICTION;
+			Debris.NumBounces[i]++;
+		}
+	}
+}
+
+// Repeatedly shatters largest static mesh of loaded level and updates debris against level geometry, until pool
+// has been filled and drained several times. Original static is left untouched, as copy of it is shattered.
+// Logs cost of template building, shattering and update per fragment, including floor and sector cache queries.
+bool BenchmarkDebris()
+{
+	constexpr auto FRAME_COUNT = 1000;
+
+	// Find static with most fragments.
+	const MESH_INFO* sourceMesh = nullptr;
+	int meshIndex = -1;
+	int polygonCount = 0;
+	for (const auto& room : g_Level.Rooms)
+	{
+		for (const auto& mesh : room.mesh)
+		{
+			int staticMeshIndex = StaticObjects[mesh.staticNumber].meshNumber;
+			if (staticMeshIndex < 0 || staticMeshIndex >= g_Level.Meshes.size())
+				continue;
+
+			int count = 0;
+			for (const auto& bucket : g_Level.Meshes[staticMeshIndex].buckets)
+				count += (int)bucket.polygons.size();
+
+			if (count > polygonCount)
+			{
+				sourceMesh = &mesh;
+				meshIndex = staticMeshIndex;
+				polygonCount = count;
 			}
 		}
 	}
+
+	if (sourceMesh == nullptr)
+	{
+		TENLog("Debris: level has no static meshes to shatter.", LogLevel::Warning);
+		return true;
+	}
+
+	DisableDebris();
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	int fragmentCount = (int)GetShatterTemplate(meshIndex).Meshes.size();
+	auto templateTime = std::chrono::high_resolution_clock::now() - startTime;
+
+	auto shatterTime = std::chrono::nanoseconds::zero();
+	auto updateTime = std::chrono::nanoseconds::zero();
+	int shatterCount = 0;
+	long long fragmentUpdateCount = 0;
+	bool isPassed = true;
+
+	for (int frame = 0; frame < FRAME_COUNT; frame++)
+	{
+		// Refill pool whenever there is room for whole mesh, as when several statics are smashed in row.
+		if ((Debris.Count + fragmentCount) <= MAX_DEBRIS)
+		{
+			auto mesh = *sourceMesh;
+			mesh.flags |= StaticMeshFlags::SM_VISIBLE;
+
+			ShatterImpactData.impactDirection = Vector3(0.0f, -1.0f, 0.0f);
+			ShatterImpactData.impactLocation = mesh.pos.Position.ToVector3();
+
+			short smashedMeshCount = SmashedMeshCount;
+			startTime = std::chrono::high_resolution_clock::now();
+			ShatterObject(nullptr, &mesh, -64, mesh.roomNumber, 0);
+			shatterTime += std::chrono::high_resolution_clock::now() - startTime;
+			SmashedMeshCount = smashedMeshCount;
+
+			shatterCount++;
+		}
+
+		fragmentUpdateCount += Debris.Count;
+
+		startTime = std::chrono::high_resolution_clock::now();
+		UpdateDebris();
+		updateTime += std::chrono::high_resolution_clock::now() - startTime;
+
+		for (int i = 0; i < Debris.Count; i++)
+		{
+			if (Debris.RoomNumbers[i] < 0 || Debris.RoomNumbers[i] >= g_Level.Rooms.size())
+				isPassed = false;
+		}
+	}
+
+	DisableDebris();
+
+	using us = std::chrono::duration<double, std::micro>;
+	TENLog("Debris: mesh " + std::to_string(meshIndex) + " with " + std::to_string(fragmentCount) + " fragments, template built in " +
+		   std::to_string(us(templateTime).count()) + " us. Shattered " + std::to_string(shatterCount) + " times in " +
+		   std::to_string((shatterCount > 0) ? (us(shatterTime).count() / shatterCount) : 0.0) + " us each (" +
+		   std::to_string((shatterCount > 0 && fragmentCount > 0) ? (us(shatterTime).count() / ((double)shatterCount * fragmentCount)) : 0.0) + " us per fragment). " +
+		   "Update " + std::to_string(us(updateTime).count() / FRAME_COUNT) + " us per frame, " +
+		   std::to_string((fragmentUpdateCount > 0) ? (us(updateTime).count() / fragmentUpdateCount) : 0.0) + " us per fragment over " +
+		   std::to_string(fragmentUpdateCount) + " fragment updates.", LogLevel::Info);
+
+	return isPassed;
 }
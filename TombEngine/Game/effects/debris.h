@@ -51,29 +51,39 @@ struct DebrisMesh
 	int tex;
 };
 
-struct DebrisFragment
+// Mesh split into shatter fragments once, so shattering only has to transform and copy them.
+// Fragment vertex positions are relative to fragment centroid and unscaled.
+struct ShatterTemplate
 {
-	DebrisMesh mesh;
-	Quaternion rotation;
-	Vector3 angularVelocity;
-	Vector3 worldPosition;
-	Vector3  velocity;
-	Vector3 gravity;
-	float terminalVelocity;
-	float linearDrag;
-	float angularDrag;
-	float friction;
-	float restitution;
-	Vector4 color;
-	LIGHT_MODES lightMode;
-	int roomNumber;
-	int numBounces;
-	bool active;
-	bool isStatic;
+	bool					IsBuilt	  = false;
+	std::vector<Vector3>	Centroids = {};
+	std::vector<DebrisMesh> Meshes	  = {};
+};
+
+// Debris is kept in parallel arrays. Active fragments are packed at front of pool, so update and drawing
+// never visit free slots, and fragments are spawned and removed in constant time.
+struct DebrisPool
+{
+	int Count = 0;
+
+	// Simulation state.
+	std::array<Vector3, MAX_DEBRIS>		  Positions			= {};
+	std::array<Vector3, MAX_DEBRIS>		  Velocities		= {};
+	std::array<Quaternion, MAX_DEBRIS>	  Orientations		= {};
+	std::array<Vector3, MAX_DEBRIS>		  AngularVelocities = {};
+	std::array<float, MAX_DEBRIS>		  AngularDrags		= {};
+	std::array<int, MAX_DEBRIS>			  RoomNumbers		= {};
+	std::array<unsigned char, MAX_DEBRIS> NumBounces		= {};
+
+	// Drawing state.
+	std::array<DebrisMesh, MAX_DEBRIS>	Meshes	   = {};
+	std::array<Vector4, MAX_DEBRIS>		Colors	   = {};
+	std::array<LIGHT_MODES, MAX_DEBRIS> LightModes = {};
+	std::array<bool, MAX_DEBRIS>		IsStatic   = {};
 };
 
 extern SHATTER_ITEM ShatterItem;
-extern std::vector<DebrisFragment> DebrisFragments;
+extern DebrisPool Debris;
 extern ShatterImpactInfo ShatterImpactData;
 extern short SmashedMeshCount;
 extern MESH_INFO* SmashedMesh[32];
@@ -81,7 +91,8 @@ extern short SmashedMeshRoom[32];
 
 bool ExplodeItemNode(ItemInfo* item, int node, int noXZVel, int bits);
 void ShatterObject(SHATTER_ITEM* item, MESH_INFO* mesh, int num, short roomNumber, int noZXVel);
-DebrisFragment* GetFreeDebrisFragment();
 Vector3 CalculateFragmentImpactVelocity(const Vector3& fragmentWorldPosition, const Vector3& impactDirection, const Vector3& impactLocation);
 void DisableDebris();
+void ClearShatterTemplates();
 void UpdateDebris();
+bool BenchmarkDebris();
@@ -81,7 +81,7 @@ struct FX_INFO
 	short roomNumber;
 	short objectNumber;
 	short nextFx;
-	short nextActive;
+	short activeSlot; // Position in ActiveEffects, or NO_ITEM if not listed.
 	short speed;
 	short fallspeed;
 	int frameNumber;
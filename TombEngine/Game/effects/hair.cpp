@@ -21,98 +21,90 @@ namespace TEN::Effects::Hair
 {
 	HairEffectController HairEffect = {};
 
-	void HairUnit::Update(const ItemInfo& item, int hairUnitIndex)
+	void HairEffectController::Initialize()
 	{
-		const auto& player = GetLaraInfo(item);
+		constexpr auto ORIENT_DEFAULT = EulerAngles(ANGLE(-90.0f), 0, 0);
 
 		bool isYoung = (g_GameFlow->GetLevel(CurrentLevel)->GetLaraType() == LaraType::Young);
 
+		// NOTE: Joint offsets determine segment lengths.
+		auto jointOffsets = std::vector<Vector3>{};
+		for (int i = 0; i < Objects[ID_HAIR].nmeshes; i++)
+			jointOffsets.push_back(GetJointOffset(ID_HAIR, i));
+
+		Solver.Initialize(UNIT_COUNT_MAX, jointOffsets, ORIENT_DEFAULT.ToQuaternion());
+
+		// First unit is only used by young player, who has two pigtails instead of braid.
+		for (int i = 0; i < UNIT_COUNT_MAX; i++)
+			Solver.SetStrandEnabled(i, (i != 0 || isYoung));
+	}
+
+	void HairEffectController::Update(ItemInfo& item, bool isYoung)
+	{
+		const auto& player = GetLaraInfo(item);
+
 		// Get world matrix from head bone.
-		auto worldMatrix = Matrix::Identity;
-		g_Renderer.GetBoneMatrix(item.Index, LM_HEAD, &worldMatrix);
+		auto headMatrix = Matrix::Identity;
+		g_Renderer.GetBoneMatrix(item.Index, LM_HEAD, &headMatrix);
 
-		// Apply base offset to world matrix.
-		auto relOffset = GetRelBaseOffset(hairUnitIndex, isYoung);
-		worldMatrix = Matrix::CreateTranslation(relOffset) * worldMatrix;
-		
 		// Use player's head bone orientation as base.
 		auto baseOrient = Geometry::ConvertDirectionToQuat(-Geometry::ConvertQuatToDirection(GetBoneOrientation(item, LM_HEAD)));
+		short twistAngle = EulerAngles(baseOrient).y;
 
-		// Set position of base segment.
-		auto basePos = worldMatrix.Translation();
-		Segments[0].Position = basePos;
+		// Get water height.
+		auto pos = item.Pose.Position + Vector3i(GetWaterProbeOffset(item));
+		int roomNumber = item.RoomNumber;
+		int waterHeight = GetWaterHeight(pos.x, pos.y, pos.z, roomNumber);
 
-		if (!IsInitialized)
-		{
-			// Update segment positions.
-			for (int i = 0; i < Segments.size() - 1; i++)
-			{
-				auto& segment = Segments[i];
-				auto& nextSegment = Segments[i + 1];
+		// TR3 UPV uses a hack which forces player water status to dry. 
+		// Therefore, cannot directly use water status value to determine enrironment.
+		bool isOnLand = (player.Control.WaterStatus == WaterStatus::Dry &&
+						 (player.Context.Vehicle == -1 || g_Level.Items[player.Context.Vehicle].ObjectNumber != ID_UPV));
 
-				// NOTE: Joint offset determines segment length.
-				auto jointOffset = GetJointOffset(ID_HAIR, i);
+		// Get collision spheres.
+		GetSpheres(item, isYoung, m_spheres);
 
-				worldMatrix = Matrix::CreateTranslation(segment.Position);
-				worldMatrix = Matrix::CreateFromQuaternion(segment.Orientation) * worldMatrix;
-				worldMatrix = Matrix::CreateTranslation(jointOffset) * worldMatrix;
+		int strandCount = Solver.GetStrandCount();
+		int segmentCount = Solver.GetSegmentCount();
 
-				nextSegment.Position = worldMatrix.Translation();
-			}
+		m_inputs.resize(strandCount);
+		m_probes.resize(strandCount * segmentCount);
 
-			IsInitialized = true;
-		}
-		else
+		for (int i = 0; i < strandCount; i++)
 		{
-			// Get water height.
-			auto pos = item.Pose.Position + Vector3i(GetWaterProbeOffset(item));
-			int roomNumber = item.RoomNumber;
-			int waterHeight = GetWaterHeight(pos.x, pos.y, pos.z, roomNumber);
-
-			// Get collision spheres.
-			auto spheres = GetSpheres(item, isYoung);
-
-			// Update segments.
-			for (int i = 1; i < Segments.size(); i++)
+			if (!Solver.IsStrandEnabled(i))
+				continue;
+
+			auto& input = m_inputs[i];
+			input.BasePosition = Vector3::Transform(GetRelBaseOffset(i, isYoung), headMatrix);
+			input.TwistAngle = twistAngle;
+			input.StepCount = (isYoung && i == 1) ? 2 : 1; // NOTE: Right pigtail was always updated twice.
+			input.IsOnLand = isOnLand;
+			input.WaterHeight = waterHeight;
+			input.Wind = Weather.Wind();
+
+			// Probe room at current segment positions. Base segment is attached to head and isn't probed.
+			const auto* positions = Solver.GetPositions(i);
+			for (int j = 1; j < segmentCount; j++)
 			{
-				auto& segment = Segments[i];
-				auto& prevSegment = Segments[i - 1];
-
-				// TR3 UPV uses a hack which forces player water status to dry. 
-				// Therefore, cannot directly use water status value to determine enrironment.
-				bool isOnLand = (player.Control.WaterStatus == WaterStatus::Dry &&
-								 (player.Context.Vehicle == -1 || g_Level.Items[player.Context.Vehicle].ObjectNumber != ID_UPV));
+				const auto& segmentPos = positions[j];
+				auto pointColl = GetCollision(segmentPos.x, segmentPos.y, segmentPos.z, roomNumber);
 
-				// Handle segment room collision.
-				CollideSegmentWithRoom(segment, waterHeight, roomNumber, isOnLand);
-
-				// Handle segment sphere collision.
-				CollideSegmentWithSpheres(segment, spheres);
-
-				// Calculate orientation.
-				prevSegment.Orientation = GetSegmentOrientation(prevSegment.Position, segment.Position, baseOrient);
-
-				// Calculate world matrix.
-				worldMatrix = Matrix::CreateTranslation(prevSegment.Position);
-				worldMatrix = Matrix::CreateFromQuaternion(prevSegment.Orientation) * worldMatrix;
-
-				auto jointOffset = (i == (Segments.size() - 1)) ?
-					GetJointOffset(ID_HAIR, (i - 1) - 1) :
-					GetJointOffset(ID_HAIR, (i - 1));
-				worldMatrix = Matrix::CreateTranslation(jointOffset) * worldMatrix;
-
-				segment.Position = worldMatrix.Translation();
-				segment.Velocity = (segment.Position - Segments[0].Velocity) * 0.9f;
+				auto& probe = m_probes[(i * segmentCount) + j];
+				probe.FloorHeight = pointColl.Position.Floor;
+				probe.IsWindy = TestEnvironment(ENV_FLAG_WIND, pointColl.RoomNumber);
 			}
 		}
+
+		Solver.Step(m_inputs, m_probes, m_spheres);
 	}
 
-	Vector3 HairUnit::GetRelBaseOffset(int hairUnitIndex, bool isYoung)
+	Vector3 HairEffectController::GetRelBaseOffset(int unitIndex, bool isYoung)
 	{
 		auto relOffset = Vector3::Zero;
 		if (isYoung)
 		{
-			switch (hairUnitIndex)
+			switch (unitIndex)
 			{
 			// Left pigtail offset.
 			case 0:
@@ -134,7 +126,7 @@ namespace TEN::Effects::Hair
 		return relOffset;
 	}
 
-	Vector3 HairUnit::GetWaterProbeOffset(const ItemInfo& item)
+	Vector3 HairEffectController::GetWaterProbeOffset(const ItemInfo& item)
 	{
 		const auto& player = GetLaraInfo(item);
 
@@ -169,30 +161,14 @@ namespace TEN::Effects::Hair
 		const auto& frame = GetBestFrame(item);
 		return frame.BoundingBox.GetCenter();
 	}
-	
-	Quaternion HairUnit::GetSegmentOrientation(const Vector3& origin, const Vector3& target, const Quaternion& baseOrient)
-	{
-		// Calculate absolute orientation.
-		auto absDirection = target - origin;
-		absDirection.Normalize();
-		auto absOrient = Geometry::ConvertDirectionToQuat(absDirection);
-
-		// Calculate relative twist rotation.
-		// TODO: Find accurate twist angle based on relation between absOrient and baseOrient.
-		auto twistAxisAngle = AxisAngle(absDirection, EulerAngles(baseOrient).y);
-		auto twistRot = twistAxisAngle.ToQuaternion();
-
-		// Return ideal orientation.
-		return (absOrient * twistRot);
-	}
 
-	std::vector<BoundingSphere> HairUnit::GetSpheres(const ItemInfo& item, bool isYoung)
+	void HairEffectController::GetSpheres(const ItemInfo& item, bool isYoung, std::vector<BoundingSphere>& spheres)
 	{
 		constexpr auto SPHERE_COUNT		   = 8;
 		constexpr auto TORSO_SPHERE_OFFSET = Vector3i(-10, 0, 25);
 		constexpr auto HEAD_SPHERE_OFFSET  = Vector3i(-2, 0, 0);
 
-		auto spheres = std::vector<BoundingSphere>{};
+		spheres.clear();
 		spheres.reserve(SPHERE_COUNT);
 
 		// Hips sphere.
@@ -245,110 +221,5 @@ namespace TEN::Effects::Hair
 
 		if (isYoung)
 			spheres[1].Center = (spheres[1].Center + spheres[2].Center) / 2;
-
-		return spheres;
-	}
-	
-	void HairUnit::CollideSegmentWithRoom(HairSegment& segment, int waterHeight, int roomNumber, bool isOnLand)
-	{
-		constexpr auto VELOCITY_COEFF = 0.75f;
-
-		auto pointColl = GetCollision(segment.Position.x, segment.Position.y, segment.Position.z, roomNumber);
-		int floorHeight = pointColl.Position.Floor;
-
-		Segments[0].Velocity = segment.Position;
-		segment.Position += segment.Velocity * VELOCITY_COEFF;
-
-		// Land collision.
-		if (isOnLand)
-		{
-			// Let wind affect position.
-			if (TestEnvironment(ENV_FLAG_WIND, pointColl.RoomNumber))
-				segment.Position += Weather.Wind() * 2;
-
-			// Apply gravity.
-			segment.Position.y += HAIR_GRAVITY;
-
-			// Float on water surface.
-			if (waterHeight != NO_HEIGHT && segment.Position.y > waterHeight)
-			{
-				segment.Position.y = waterHeight;
-			}
-			// Avoid clipping through floor.
-			else if (floorHeight > Segments[0].Position.y && segment.Position.y > floorHeight)
-			{
-				segment.Position = Segments[0].Velocity;
-			}
-		}
-		// Water collision.
-		else
-		{
-			if (segment.Position.y < waterHeight)
-			{
-				segment.Position.y = waterHeight;
-			}
-			else if (segment.Position.y > floorHeight)
-			{
-				segment.Position.y = floorHeight;
-			}
-		}
-	}
-
-	void HairUnit::CollideSegmentWithSpheres(HairSegment& segment, const std::vector<BoundingSphere>& spheres)
-	{
-		for (const auto& sphere : spheres)
-		{
-			auto direction = segment.Position - sphere.Center;
-
-			float distance = Vector3::Distance(segment.Position, sphere.Center);
-			if (distance < sphere.Radius)
-			{
-				// Avoid division by zero.
-				if (distance == 0.0f)
-					distance = 1.0f;
-
-				// Push segment away from sphere.
-				segment.Position = sphere.Center + (direction * (sphere.Radius / distance));
-			}
-		}
-	}
-
-	void HairEffectController::Initialize()
-	{
-		constexpr auto ORIENT_DEFAULT = EulerAngles(ANGLE(-90.0f), 0, 0);
-
-		bool isYoung = (g_GameFlow->GetLevel(CurrentLevel)->GetLaraType() == LaraType::Young);
-
-		// Initialize hair units.
-		bool isHead = true;
-		for (auto& unit : Units)
-		{
-			unit.IsEnabled = (!isHead || isYoung);
-			unit.IsInitialized = false;
-			
-			unsigned int segmentCount = Objects[ID_HAIR].nmeshes + 1;
-			unit.Segments.resize(segmentCount);
-
-			// Initialize segments.
-			for (auto& segment : unit.Segments)
-			{
-				segment.Position = GetJointOffset(ID_HAIR, 0);
-				segment.Velocity = Vector3::Zero;
-				segment.Orientation = ORIENT_DEFAULT.ToQuaternion();
-			}
-
-			isHead = false;
-		}
-	}
-
-	void HairEffectController::Update(ItemInfo& item, bool isYoung)
-	{
-		for (int i = 0; i < Units.size(); i++)
-		{
-			Units[i].Update(item, i);
-
-			if (isYoung && i == 1)
-				Units[i].Update(item, i);
-		}
 	}
 }
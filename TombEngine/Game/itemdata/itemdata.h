@@ -1,7 +1,9 @@
 #pragma once
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <variant>
 
 #include "Game/collision/collide_room.h"
@@ -33,6 +35,60 @@ using namespace TEN::Entities::TR4;
 using namespace TEN::Entities::Vehicles;
 
 struct ItemInfo;
+class ItemData;
+
+// Payloads larger than this are stored on heap, so that ItemData (and therefore ItemInfo)
+// stays small for item walks which never touch it.
+constexpr auto ITEM_DATA_INLINE_SIZE_MAX = 32;
+
+template<typename T>
+class ItemDataBox
+{
+private:
+	// Null only in moved-from box. Default value is restored on access, so that moved-from box
+	// stays as usable as moved-from inline payload.
+	mutable std::unique_ptr<T> Value = nullptr;
+
+public:
+	ItemDataBox(const T& value) : Value(std::make_unique<T>(value)) {}
+	ItemDataBox(T&& value) : Value(std::make_unique<T>(std::move(value))) {}
+	ItemDataBox(const ItemDataBox& other) : Value((other.Value != nullptr) ? std::make_unique<T>(*other.Value) : nullptr) {}
+	ItemDataBox(ItemDataBox&& other) noexcept = default;
+
+	ItemDataBox& operator =(const ItemDataBox& other)
+	{
+		if (this != &other)
+			Value = (other.Value != nullptr) ? std::make_unique<T>(*other.Value) : nullptr;
+
+		return *this;
+	}
+
+	ItemDataBox& operator =(ItemDataBox&& other) noexcept = default;
+
+	T& Get() { return GetValue(); }
+	const T& Get() const { return GetValue(); }
+
+private:
+	T& GetValue() const
+	{
+		if (Value == nullptr)
+			Value = std::make_unique<T>();
+
+		return *Value;
+	}
+};
+
+template<typename T>
+using ItemDataStorage = std::conditional_t<(sizeof(T) > ITEM_DATA_INLINE_SIZE_MAX), ItemDataBox<T>, T>;
+
+template<typename T>
+using EnableIfNotItemData = std::enable_if_t<!std::is_same_v<std::decay_t<T>, ItemData>, int>;
+
+template<typename T>
+T& UnboxItemData(T& value) { return value; }
+
+template<typename T>
+T& UnboxItemData(ItemDataBox<T>& value) { return value.Get(); }
 
 class ItemData
 {
@@ -52,41 +108,41 @@ class ItemData
 		double,
 		long double,
 		std::array<short, 4>,
-		GameVector,
-		DOOR_DATA,
-		PushableInfo,
+		ItemDataStorage<GameVector>,
+		ItemDataStorage<DOOR_DATA>,
+		ItemDataStorage<PushableInfo>,
 		ItemInfo*,
 		LaraInfo*,
-		CollisionInfo,
-		CreatureInfo,
-		WraithInfo,
-		GuardianInfo,
-		QuadBikeInfo,
-		BigGunInfo,
-		MotorbikeInfo,
-		JeepInfo,
-		KayakInfo,
-		SkidooInfo,
-		UPVInfo,
-		SpeedboatInfo,
-		RubberBoatInfo,
-		MinecartInfo,
-		ElectricalLightInfo
+		ItemDataStorage<CollisionInfo>,
+		ItemDataStorage<CreatureInfo>,
+		ItemDataStorage<WraithInfo>,
+		ItemDataStorage<GuardianInfo>,
+		ItemDataStorage<QuadBikeInfo>,
+		ItemDataStorage<BigGunInfo>,
+		ItemDataStorage<MotorbikeInfo>,
+		ItemDataStorage<JeepInfo>,
+		ItemDataStorage<KayakInfo>,
+		ItemDataStorage<SkidooInfo>,
+		ItemDataStorage<UPVInfo>,
+		ItemDataStorage<SpeedboatInfo>,
+		ItemDataStorage<RubberBoatInfo>,
+		ItemDataStorage<MinecartInfo>,
+		ItemDataStorage<ElectricalLightInfo>
 	> data;
 	public:
 	ItemData();
 
-	template<typename D>
-	ItemData(D&& type) : data(std::move(type)) {}
+	template<typename D, EnableIfNotItemData<D> = 0>
+	ItemData(D&& type) : data(ItemDataStorage<std::decay_t<D>>(std::forward<D>(type))) {}
 
 	// Conversion operators to keep original syntax.
 	// TODO: Should be removed later and use polymorphism instead.
 	template<typename T>
 	operator T* ()
 	{
-		if (std::holds_alternative<T>(data))
+		if (std::holds_alternative<ItemDataStorage<T>>(data))
 		{
-			auto& ref = std::get<T>(data);
+			auto& ref = UnboxItemData(std::get<ItemDataStorage<T>>(data));
 			return &ref;
 		}
 
@@ -96,9 +152,9 @@ class ItemData
 	template<typename T>
 	operator T& ()
 	{
-		if (std::holds_alternative<T>(data))
+		if (std::holds_alternative<ItemDataStorage<T>>(data))
 		{
-			auto& ref = std::get<T>(data);
+			auto& ref = UnboxItemData(std::get<ItemDataStorage<T>>(data));
 			return ref;
 		}
 
@@ -120,17 +176,17 @@ class ItemData
 		return *this;
 	}
 
-	template<typename T>
+	template<typename T, EnableIfNotItemData<T> = 0>
 	ItemData& operator =(T& newData)
 	{
-		data = newData;
+		data = ItemDataStorage<std::decay_t<T>>(newData);
 		return *this;
 	}
 
-	template<typename T>
+	template<typename T, EnableIfNotItemData<T> = 0>
 	ItemData& operator =(T&& newData)
 	{
-		data = std::move(newData);
+		data = ItemDataStorage<std::decay_t<T>>(std::move(newData));
 		return *this;
 	}
 
@@ -142,18 +198,18 @@ class ItemData
 	template<typename ... Funcs>
 	void apply(Funcs&&... funcs)
 	{
-		std::visit(
-			visitor
-			{
-				[](auto const&) {},
-				std::forward<Funcs>(funcs)...
-			},
-			data);
+		auto funcVisitor = visitor
+		{
+			[](auto const&) {},
+			std::forward<Funcs>(funcs)...
+		};
+
+		std::visit([&funcVisitor](auto& value) { funcVisitor(UnboxItemData(value)); }, data);
 	}
 
 	template<typename T>
 	bool is() const
 	{
-		return std::holds_alternative<T>(data);
+		return std::holds_alternative<ItemDataStorage<T>>(data);
 	}
 };
@@ -29,6 +29,9 @@ using namespace TEN::Math;
 
 constexpr int ITEM_DEATH_TIMEOUT = 4 * FPS;
 
+static bool ActiveItemsDirty   = false;
+static bool ActiveEffectsDirty = false;
+
 bool ItemInfo::TestOcb(short ocbFlags) const
 {
 	return ((TriggerFlags & ocbFlags) == ocbFlags);
@@ -179,6 +182,38 @@ bool TestState(int refState, const vector<int>& stateList)
 	return false;
 }
 
+// Removes item from ActiveItems by swapping last entry into its slot. Must not be used while ActiveItems is iterated.
+static void UnlinkActiveItem(short itemNumber)
+{
+	auto& item = g_Level.Items[itemNumber];
+	if (item.ActiveSlot == NO_ITEM)
+		return;
+
+	short lastItemNumber = ActiveItems.back();
+	ActiveItems[item.ActiveSlot] = lastItemNumber;
+	if (lastItemNumber != NO_ITEM)
+		g_Level.Items[lastItemNumber].ActiveSlot = item.ActiveSlot;
+
+	ActiveItems.pop_back();
+	item.ActiveSlot = NO_ITEM;
+	ActiveItemsDirty = true;
+}
+
+static void UnlinkActiveEffect(short fxNumber)
+{
+	auto& fx = EffectList[fxNumber];
+	if (fx.activeSlot == NO_ITEM)
+		return;
+
+	short lastFxNumber = ActiveEffects.back();
+	ActiveEffects[fx.activeSlot] = lastFxNumber;
+	EffectList[lastFxNumber].activeSlot = fx.activeSlot;
+
+	ActiveEffects.pop_back();
+	fx.activeSlot = NO_ITEM;
+	ActiveEffectsDirty = true;
+}
+
 static void GameScriptHandleKilled(short itemNumber, bool destroyed)
 {
 	auto* item = &g_Level.Items[itemNumber];
@@ -205,29 +240,13 @@ void KillItem(short const itemNumber)
 		ItemNewRooms[2 * ItemNewRoomNo] = itemNumber | 0x8000;
 		ItemNewRoomNo++;
 	}
-	else// if (NextItemActive != NO_ITEM)
+	else
 	{
 		auto* item = &g_Level.Items[itemNumber];
 
 		DetatchSpark(itemNumber, SP_ITEM);
 		item->Active = false;
-
-		if (NextItemActive == itemNumber)
-		{
-			NextItemActive = item->NextActive;
-		}
-		else
-		{
-			short linkNumber;
-			for (linkNumber = NextItemActive; linkNumber != NO_ITEM; linkNumber = g_Level.Items[linkNumber].NextActive)
-			{
-				if (g_Level.Items[linkNumber].NextActive == itemNumber)
-				{
-					g_Level.Items[linkNumber].NextActive = item->NextActive;
-					break;
-				}
-			}
-		}
+		UnlinkActiveItem(itemNumber);
 
 		if (item->RoomNumber != NO_ROOM)
 		{
@@ -261,6 +280,7 @@ void KillItem(short const itemNumber)
 
 		if (itemNumber >= g_Level.NumItems)
 		{
+			item->Generation++;
 			item->NextItem = NextItemFree;
 			NextItemFree = itemNumber;
 		}
@@ -305,8 +325,14 @@ void AddActiveItem(short itemNumber)
 	if (!item->Active)
 	{
 		item->Active = true;
-		item->NextActive = NextItemActive;
-		NextItemActive = itemNumber;
+
+		// Some objects toggle Active directly while staying listed, so check slot to avoid duplicates.
+		if (item->ActiveSlot == NO_ITEM)
+		{
+			item->ActiveSlot = (int)ActiveItems.size();
+			ActiveItems.push_back(itemNumber);
+			ActiveItemsDirty = true;
+		}
 	}
 }
 
@@ -391,20 +417,7 @@ void KillEffect(short fxNumber)
 	{
 		auto* fx = &EffectList[fxNumber];
 		DetatchSpark(fxNumber, SP_FX);
-
-		if (NextFxActive == fxNumber)
-			NextFxActive = fx->nextActive;
-		else
-		{
-			for (short linkNumber = NextFxActive; linkNumber != NO_ITEM; linkNumber = EffectList[linkNumber].nextActive)
-			{
-				if (EffectList[linkNumber].nextActive == fxNumber)
-				{
-					EffectList[linkNumber].nextActive = fx->nextActive;
-					break;
-				}
-			}
-		}
+		UnlinkActiveEffect(fxNumber);
 
 		if (g_Level.Rooms[fx->roomNumber].fxNumber == fxNumber)
 			g_Level.Rooms[fx->roomNumber].fxNumber = fx->nextFx;
@@ -439,8 +452,9 @@ short CreateNewEffect(short roomNumber)
 		fx->roomNumber = roomNumber;
 		fx->nextFx = room->fxNumber;
 		room->fxNumber = fxNumber;
-		fx->nextActive = NextFxActive;
-		NextFxActive = fxNumber;
+		fx->activeSlot = (short)ActiveEffects.size();
+		ActiveEffects.push_back(fxNumber);
+		ActiveEffectsDirty = true;
 		fx->color = Vector4::One;
 	}
 
@@ -449,13 +463,15 @@ short CreateNewEffect(short roomNumber)
 
 void InitializeFXArray(int allocateMemory)
 {
-	NextFxActive = NO_ITEM;
 	NextFxFree = 0;
+	ActiveEffects.clear();
+	ActiveEffects.reserve(NUM_EFFECTS);
 
 	for (int i = 0; i < NUM_EFFECTS; i++)
 	{
 		auto* fx = &EffectList[i];
 		fx->nextFx = i + 1;
+		fx->activeSlot = NO_ITEM;
 	}
 
 	EffectList[NUM_EFFECTS - 1].nextFx = NO_ITEM;
@@ -482,24 +498,25 @@ void RemoveDrawnItem(short itemNumber)
 
 void RemoveActiveItem(short itemNumber, bool killed) 
 {
-	if (g_Level.Items[itemNumber].Active)
+	auto& item = g_Level.Items[itemNumber];
+
+	if (item.Active)
 	{
-		g_Level.Items[itemNumber].Active = false;
+		item.Active = false;
 
-		if (NextItemActive == itemNumber)
+		// While ActiveItems is iterated, leave tombstone in place and compact it later in UpdateActiveItems().
+		if (InItemControlLoop)
 		{
-			NextItemActive = g_Level.Items[itemNumber].NextActive;
+			if (item.ActiveSlot != NO_ITEM)
+			{
+				ActiveItems[item.ActiveSlot] = NO_ITEM;
+				item.ActiveSlot = NO_ITEM;
+				ActiveItemsDirty = true;
+			}
 		}
 		else
 		{
-			for (short linkNumber = NextItemActive; linkNumber != NO_ITEM; linkNumber = g_Level.Items[linkNumber].NextActive)
-			{
-				if (g_Level.Items[linkNumber].NextActive == itemNumber)
-				{
-					g_Level.Items[linkNumber].NextActive = g_Level.Items[itemNumber].NextActive;
-					break;
-				}
-			}
+			UnlinkActiveItem(itemNumber);
 		}
 
 		if (killed)
@@ -576,7 +593,7 @@ void InitializeItem(short itemNumber)
 
 short CreateItem()
 {
-	if (NextItemFree == NO_ITEM)
+	if (NextItemFree == NO_ITEM && !GrowItemArray((int)g_Level.Items.size() + NUM_ITEMS))
 		return NO_ITEM;
 
 	short itemNumber = NextItemFree;
@@ -588,7 +605,11 @@ short CreateItem()
 
 void InitializeItemArray(int totalItem)
 {
+	totalItem = std::min(std::max(totalItem, g_Level.NumItems + 1), MAX_ITEMS);
+
+	// Reserve whole pool up front so that growing it never invalidates ItemInfo pointers.
 	g_Level.Items.clear();
+	g_Level.Items.reserve(MAX_ITEMS);
 	g_Level.Items.resize(totalItem);
 
 	for (int i = 0; i < totalItem; i++)
@@ -607,8 +628,63 @@ void InitializeItemArray(int totalItem)
 	}
 
 	item->NextItem = NO_ITEM;
-	NextItemActive = NO_ITEM;
 	NextItemFree = g_Level.NumItems;
+
+	ActiveItems.clear();
+	ActiveItems.reserve(totalItem);
+	ActiveItemsDirty = false;
+}
+
+bool GrowItemArray(int totalItem)
+{
+	int prevTotalItem = (int)g_Level.Items.size();
+	totalItem = std::min(totalItem, MAX_ITEMS);
+
+	if (totalItem <= prevTotalItem)
+	{
+		TENLog("Item pool limit of " + std::to_string(MAX_ITEMS) + " items reached.", LogLevel::Warning);
+		return false;
+	}
+
+	g_Level.Items.resize(totalItem);
+
+	// Prepend new slots to free list.
+	for (int i = prevTotalItem; i < totalItem; i++)
+	{
+		auto& item = g_Level.Items[i];
+
+		item.Index = i;
+		item.NextItem = (i + 1 < totalItem) ? (i + 1) : NextItemFree;
+		item.Active = false;
+		item.Data = nullptr;
+	}
+
+	NextItemFree = prevTotalItem;
+	return true;
+}
+
+ItemHandle GetItemHandle(int itemNumber)
+{
+	if (itemNumber < 0 || itemNumber >= g_Level.Items.size())
+		return ItemHandle{};
+
+	return ItemHandle{ itemNumber, g_Level.Items[itemNumber].Generation };
+}
+
+ItemInfo* GetItem(const ItemHandle& handle)
+{
+	if (!IsItemHandleValid(handle))
+		return nullptr;
+
+	return &g_Level.Items[handle.Index];
+}
+
+bool IsItemHandleValid(const ItemHandle& handle)
+{
+	if (handle.Index < 0 || handle.Index >= g_Level.Items.size())
+		return false;
+
+	return (g_Level.Items[handle.Index].Generation == handle.Generation);
 }
 
 short SpawnItem(ItemInfo* item, GAME_OBJECT_ID objectNumber)
@@ -680,17 +756,13 @@ std::vector<int> FindCreatedItems(GAME_OBJECT_ID objectID)
 {
 	auto itemNumbers = std::vector<int>{};
 
-	if (NextItemActive == NO_ITEM)
-		return itemNumbers;
-
-	const auto* itemPtr = &g_Level.Items[NextItemActive];
-
-	for (int nextActive = NextItemActive; nextActive != NO_ITEM; nextActive = itemPtr->NextActive)
+	for (short itemNumber : ActiveItems)
 	{
-		itemPtr = &g_Level.Items[nextActive];
+		if (itemNumber == NO_ITEM)
+			continue;
 
-		if (itemPtr->ObjectNumber == objectID)
-			itemNumbers.push_back(nextActive);
+		if (g_Level.Items[itemNumber].ObjectNumber == objectID)
+			itemNumbers.push_back(itemNumber);
 	}
 
 	return itemNumbers;
@@ -721,15 +793,60 @@ int FindItem(ItemInfo* item)
 	return -1;
 }
 
+void UpdateActiveItems()
+{
+	if (!ActiveItemsDirty)
+		return;
+
+	ActiveItems.erase(std::remove(ActiveItems.begin(), ActiveItems.end(), NO_ITEM), ActiveItems.end());
+
+	// Group by object ID so that items sharing same control routine are updated back to back.
+	std::stable_sort(
+		ActiveItems.begin(), ActiveItems.end(),
+		[](short itemNumber0, short itemNumber1)
+		{
+			return (g_Level.Items[itemNumber0].ObjectNumber < g_Level.Items[itemNumber1].ObjectNumber);
+		});
+
+	for (int i = 0; i < ActiveItems.size(); i++)
+		g_Level.Items[ActiveItems[i]].ActiveSlot = i;
+
+	ActiveItemsDirty = false;
+}
+
+void UpdateActiveEffects()
+{
+	if (!ActiveEffectsDirty)
+		return;
+
+	std::stable_sort(
+		ActiveEffects.begin(), ActiveEffects.end(),
+		[](short fxNumber0, short fxNumber1)
+		{
+			return (EffectList[fxNumber0].objectNumber < EffectList[fxNumber1].objectNumber);
+		});
+
+	for (int i = 0; i < ActiveEffects.size(); i++)
+		EffectList[ActiveEffects[i]].activeSlot = i;
+
+	ActiveEffectsDirty = false;
+}
+
 void UpdateAllItems()
 {
+	UpdateActiveItems();
+
 	InItemControlLoop = true;
 
-	short itemNumber = NextItemActive;
-	while (itemNumber != NO_ITEM)
+	// Items activated during loop are appended and will be updated next frame.
+	int activeCount = (int)ActiveItems.size();
+	for (int i = 0; i < activeCount; i++)
 	{
+		short itemNumber = ActiveItems[i];
+		if (itemNumber == NO_ITEM)
+			continue;
+
 		auto* item = &g_Level.Items[itemNumber];
-		short nextItem = item->NextActive;
 
 		if (!Objects.CheckID(item->ObjectNumber))
 			continue;
@@ -749,27 +866,28 @@ void UpdateAllItems()
 		}
 		else
 			KillItem(itemNumber);
-
-		itemNumber = nextItem;
 	}
 
 	InItemControlLoop = false;
 	KillMoveItems();
+	UpdateActiveItems();
 }
 
 void UpdateAllEffects()
 {
+	UpdateActiveEffects();
+
 	InItemControlLoop = true;
 
-	short fxNumber = NextFxActive;
-	while (fxNumber != NO_ITEM)
+	// KillEffect() is deferred while in control loop, so only appends can happen here.
+	int activeCount = (int)ActiveEffects.size();
+	for (int i = 0; i < activeCount; i++)
 	{
-		short nextFx = EffectList[fxNumber].nextActive;
+		short fxNumber = ActiveEffects[i];
 		auto* fx = &EffectList[fxNumber];
+
 		if (Objects[fx->objectNumber].control)
 			Objects[fx->objectNumber].control(fxNumber);
-
-		fxNumber = nextFx;
 	}
 
 	InItemControlLoop = false;
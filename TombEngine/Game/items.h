@@ -15,7 +15,8 @@ using namespace TEN::Utils;
 constexpr auto NO_ITEM		  = -1;
 constexpr auto NOT_TARGETABLE = -16384;
 
-constexpr auto NUM_ITEMS	 = 1024;
+constexpr auto NUM_ITEMS	  = 1024; // Item pool growth step.
+constexpr auto MAX_ITEMS	  = 8192; // NOTE: Must stay below 0x8000, which KillMoveItems() uses as kill flag.
 constexpr auto NUM_ITEM_FLAGS = 8;
 
 constexpr unsigned int ALL_JOINT_BITS = UINT_MAX;
@@ -107,25 +108,17 @@ struct EntityEffectData
 // TODO: We need to find good "default states" for a lot of these. -- squidshire 25/05/2022
 struct ItemInfo
 {
+	// Hot data, read by room item walks in collision, LOS and rendering. Keep it together at struct start.
 	GAME_OBJECT_ID ObjectNumber = ID_NO_OBJECT; // ObjectID
-	std::string	   Name			= {};
 
 	int Status;	// ItemStatus enum.
 	bool Active;
 
 	short Index;
 	short NextItem;
-	short NextActive;
+	int	  ActiveSlot = NO_ITEM; // Position in ActiveItems, or NO_ITEM if not listed.
 
-	ItemData Data;
-	EntityAnimationData Animation;
-	EntityCallbackData Callbacks;
-	EntityModelData Model;
-	EntityEffectData Effect;
-	
-	Pose StartPose;
 	Pose Pose;
-	ROOM_VECTOR Location;
 	short RoomNumber;
 	int Floor;
 
@@ -138,9 +131,6 @@ struct ItemInfo
 	int BoxNumber;
 	int Timer;
 
-	BitField TouchBits = BitField::Default;
-	BitField MeshBits  = BitField::Default;
-
 	unsigned short Flags; // ItemFlags enum
 	short ItemFlags[NUM_ITEM_FLAGS];
 	short TriggerFlags;
@@ -150,6 +140,23 @@ struct ItemInfo
 	short AfterDeath;
 	short CarriedItem;
 
+	EntityAnimationData Animation;
+	ROOM_VECTOR Location;
+
+	BitField TouchBits = BitField::Default;
+	BitField MeshBits  = BitField::Default;
+
+	// Cold data. Large payloads inside ItemData are stored on heap.
+	unsigned int Generation = 0; // Incremented every time item slot is freed.
+	std::string	 Name		= {};
+
+	ItemData Data;
+	EntityCallbackData Callbacks;
+	EntityModelData Model;
+	EntityEffectData Effect;
+	
+	Pose StartPose;
+
 	bool TestOcb(short ocbFlags) const;
 	void RemoveOcb(short ocbFlags);
 	void ClearAllOcb();
@@ -171,6 +178,13 @@ struct ItemInfo
 	void ResetModelToDefault();
 };
 
+// Generational reference to item slot. Becomes stale once slot is freed, even if it was reused later.
+struct ItemHandle
+{
+	int			 Index		= NO_ITEM;
+	unsigned int Generation = 0;
+};
+
 bool TestState(int refState, const std::vector<int>& stateList);
 void EffectNewRoom(short fxNumber, short roomNumber);
 void ItemNewRoom(short itemNumber, short roomNumber);
@@ -184,8 +198,14 @@ short CreateNewEffect(short roomNumber);
 void KillEffect(short fxNumber);
 void InitializeItem(short itemNumber);
 void InitializeItemArray(int totalItems);
+bool GrowItemArray(int totalItems);
+ItemHandle GetItemHandle(int itemNumber);
+ItemInfo* GetItem(const ItemHandle& handle);
+bool IsItemHandleValid(const ItemHandle& handle);
 void KillItem(short itemNumber);
 bool UpdateItemRoom(short itemNumber);
+void UpdateActiveItems();
+void UpdateActiveEffects();
 void UpdateAllItems();
 void UpdateAllEffects();
 const std::string& GetObjectName(GAME_OBJECT_ID objectID);
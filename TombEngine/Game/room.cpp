@@ -15,7 +15,8 @@ byte FlipStatus = 0;
 int FlipStats[MAX_FLIPMAP];
 int FlipMap[MAX_FLIPMAP];
 
-std::vector<short> OutsideRoomTable[OUTSIDE_SIZE][OUTSIDE_SIZE];
+RoomSectorTable OutsideRoomTable = {};
+RoomSectorTable RoomLookupTable	 = {};
 
 bool ROOM_INFO::Active()
 {
@@ -37,9 +38,8 @@ void DoFlipMap(short group)
 
 			auto* flipped = &g_Level.Rooms[room->flippedRoom];
 
-			auto temp = *room;
-			*room = *flipped;
-			*flipped = temp;
+			// Swap by move, so that room geometry and sector vectors are exchanged without being copied.
+			std::swap(*room, *flipped);
 
 			room->flippedRoom = flipped->flippedRoom;
 			flipped->flippedRoom = NO_ROOM;
@@ -51,11 +51,9 @@ void DoFlipMap(short group)
 
 			g_Renderer.FlipRooms(i, room->flippedRoom);
 
-			for (auto& fd : room->floor)
-				fd.Room = i;
-
-			for (auto& fd : flipped->floor)
-				fd.Room = room->flippedRoom;
+			// Sectors resolve their room number through slot table, so there is no need to visit them.
+			g_Level.RoomSlots[room->index] = i;
+			g_Level.RoomSlots[flipped->index] = room->flippedRoom;
 		}
 	}
 
@@ -118,20 +116,152 @@ bool IsObjectInRoom(short roomNumber, short objectNumber)
 	return true;
 }
 
-int IsRoomOutside(int x, int y, int z)
+static int FloorToSector(int value)
 {
-	if (x < 0 || z < 0)
-		return NO_ROOM;
+	return (value >= 0) ? (value / BLOCK(1)) : -((BLOCK(1) - 1 - value) / BLOCK(1));
+}
+
+void RoomSectorTable::Clear()
+{
+	OriginX = OriginZ = 0;
+	SizeX = SizeZ = 0;
+	Offsets.clear();
+	RoomNumbers.clear();
+}
+
+// Border is number of edge sectors to exclude from each side of room footprint.
+// Footprint of flipped twin is merged in, since flipmaps swap room data between both slots.
+void RoomSectorTable::Build(int border)
+{
+	Clear();
+
+	if (g_Level.Rooms.empty())
+		return;
+
+	auto getFootprint = [&](int roomNumber, int& minX, int& minZ, int& maxX, int& maxZ)
+	{
+		const auto& room = g_Level.Rooms[roomNumber];
+
+		minX = FloorToSector(room.x) + border;
+		minZ = FloorToSector(room.z) + border;
+		maxX = FloorToSector(room.x) + room.xSize - 1 - border;
+		maxZ = FloorToSector(room.z) + room.zSize - 1 - border;
+	};
+
+	// Link flip twins both ways, as only original room references its flipped counterpart.
+	auto twins = std::vector<int>(g_Level.Rooms.size(), NO_ROOM);
+	for (int i = 0; i < g_Level.Rooms.size(); i++)
+	{
+		int flippedRoom = g_Level.Rooms[i].flippedRoom;
+		if (flippedRoom != NO_ROOM && flippedRoom < g_Level.Rooms.size())
+		{
+			twins[i] = flippedRoom;
+			twins[flippedRoom] = i;
+		}
+	}
+
+	auto forEachCell = [&](int roomNumber, const std::function<void(int x, int z)>& func)
+	{
+		int minX, minZ, maxX, maxZ;
+		getFootprint(roomNumber, minX, minZ, maxX, maxZ);
+
+		int flippedRoom = twins[roomNumber];
+		if (flippedRoom == NO_ROOM)
+		{
+			for (int x = minX; x <= maxX; x++)
+			{
+				for (int z = minZ; z <= maxZ; z++)
+					func(x, z);
+			}
+
+			return;
+		}
 
-	int xTable = x / BLOCK(1);
-	int zTable = z / BLOCK(1);
+		int flipMinX, flipMinZ, flipMaxX, flipMaxZ;
+		getFootprint(flippedRoom, flipMinX, flipMinZ, flipMaxX, flipMaxZ);
 
-	if (OutsideRoomTable[xTable][zTable].empty())
+		for (int x = std::min(minX, flipMinX); x <= std::max(maxX, flipMaxX); x++)
+		{
+			for (int z = std::min(minZ, flipMinZ); z <= std::max(maxZ, flipMaxZ); z++)
+			{
+				if ((x >= minX && x <= maxX && z >= minZ && z <= maxZ) ||
+					(x >= flipMinX && x <= flipMaxX && z >= flipMinZ && z <= flipMaxZ))
+				{
+					func(x, z);
+				}
+			}
+		}
+	};
+
+	// Determine grid extents from room footprints.
+	int minX = INT_MAX;
+	int minZ = INT_MAX;
+	int maxX = INT_MIN;
+	int maxZ = INT_MIN;
+
+	for (int i = 0; i < g_Level.Rooms.size(); i++)
+	{
+		int roomMinX, roomMinZ, roomMaxX, roomMaxZ;
+		getFootprint(i, roomMinX, roomMinZ, roomMaxX, roomMaxZ);
+
+		minX = std::min(minX, roomMinX);
+		minZ = std::min(minZ, roomMinZ);
+		maxX = std::max(maxX, roomMaxX);
+		maxZ = std::max(maxZ, roomMaxZ);
+	}
+
+	if (minX > maxX || minZ > maxZ)
+		return;
+
+	OriginX = minX;
+	OriginZ = minZ;
+	SizeX = (maxX - minX) + 1;
+	SizeZ = (maxZ - minZ) + 1;
+
+	// Count rooms per cell, convert counts to offsets, then fill in ascending room order.
+	Offsets.resize((SizeX * SizeZ) + 1, 0);
+
+	for (int i = 0; i < g_Level.Rooms.size(); i++)
+		forEachCell(i, [&](int x, int z) { Offsets[((x - OriginX) * SizeZ) + (z - OriginZ) + 1]++; });
+
+	for (int i = 1; i < Offsets.size(); i++)
+		Offsets[i] += Offsets[i - 1];
+
+	RoomNumbers.resize(Offsets.back());
+	auto cursors = std::vector<int>(Offsets.begin(), Offsets.end() - 1);
+
+	for (int i = 0; i < g_Level.Rooms.size(); i++)
+		forEachCell(i, [&](int x, int z) { RoomNumbers[cursors[((x - OriginX) * SizeZ) + (z - OriginZ)]++] = i; });
+}
+
+std::pair<int, int> RoomSectorTable::GetRange(int x, int z) const
+{
+	int cellX = FloorToSector(x) - OriginX;
+	int cellZ = FloorToSector(z) - OriginZ;
+
+	if (cellX < 0 || cellX >= SizeX || cellZ < 0 || cellZ >= SizeZ)
+		return std::pair(0, 0);
+
+	int cell = (cellX * SizeZ) + cellZ;
+	return std::pair(Offsets[cell], Offsets[cell + 1]);
+}
+
+void BuildRoomSectorTables()
+{
+	// Outside table only covers room interiors, while lookup table covers everything IsPointInRoom() accepts.
+	OutsideRoomTable.Build(1);
+	RoomLookupTable.Build(0);
+}
+
+int IsRoomOutside(int x, int y, int z)
+{
+	if (x < 0 || z < 0)
 		return NO_ROOM;
 
-	for (int i = 0; i < OutsideRoomTable[xTable][zTable].size(); i++)
+	auto [first, last] = OutsideRoomTable.GetRange(x, z);
+	for (int i = first; i < last; i++)
 	{
-		short roomNumber = OutsideRoomTable[xTable][zTable][i];
+		int roomNumber = OutsideRoomTable.RoomNumbers[i];
 		auto* room = &g_Level.Rooms[roomNumber];
 
 		if ((y > room->maxceiling && y < room->minfloor) &&
@@ -207,9 +337,13 @@ int FindRoomNumber(Vector3i position, int startRoom)
 				return n;
 	}
 
-	for (int i = 0; i < g_Level.Rooms.size(); i++)
-		if (IsPointInRoom(position, i) && g_Level.Rooms[i].Active())
-			return i;
+	auto [first, last] = RoomLookupTable.GetRange(position.x, position.z);
+	for (int i = first; i < last; i++)
+	{
+		int roomNumber = RoomLookupTable.RoomNumbers[i];
+		if (IsPointInRoom(position, roomNumber) && g_Level.Rooms[roomNumber].Active())
+			return roomNumber;
+	}
 
 	return (startRoom != NO_ROOM) ? startRoom : 0;
 }
@@ -11,7 +11,6 @@ constexpr auto MAX_FLIPMAP	= 256;
 constexpr auto NUM_ROOMS	= 1024;
 constexpr auto NO_ROOM		= -1;
 constexpr auto OUTSIDE_Z	= 64;
-constexpr auto OUTSIDE_SIZE = 1024;
 
 extern byte FlipStatus;
 extern int FlipStats[MAX_FLIPMAP];
@@ -143,6 +142,26 @@ struct ROOM_INFO
 	bool Active();
 };
 
+// Compact 2D grid over level sectors listing rooms which overlap each sector column.
+// Stored in CSR form: rooms of cell N are RoomNumbers[Offsets[N]] to RoomNumbers[Offsets[N + 1] - 1], in ascending order.
+struct RoomSectorTable
+{
+	int OriginX = 0; // In sectors.
+	int OriginZ = 0; // In sectors.
+	int SizeX	= 0; // In sectors.
+	int SizeZ	= 0; // In sectors.
+
+	std::vector<int> Offsets	 = {};
+	std::vector<int> RoomNumbers = {};
+
+	void Build(int border);
+	void Clear();
+	std::pair<int, int> GetRange(int x, int z) const;
+};
+
+extern RoomSectorTable OutsideRoomTable;
+extern RoomSectorTable RoomLookupTable;
+
 void DoFlipMap(short group);
 void AddRoomFlipItems(ROOM_INFO* room);
 void RemoveRoomFlipItems(ROOM_INFO* room);
@@ -153,6 +172,7 @@ Vector3i GetRoomCenter(int roomNumber);
 int IsRoomOutside(int x, int y, int z);
 std::set<int> GetRoomList(int roomNumber);
 void InitializeNeighborRoomList();
+void BuildRoomSectorTables();
 
 GameBoundingBox& GetBoundsAccurate(const MESH_INFO& mesh, bool visibility);
 FloorInfo* GetSector(ROOM_INFO* room, int x, int z);
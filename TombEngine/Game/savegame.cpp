@@ -54,6 +54,29 @@ FileStream* SaveGame::StreamPtr;
 std::string SaveGame::FullSaveDirectory;
 int SaveGame::LastSaveGame;
 
+// Active items and effects are kept in dense arrays, but savegame stores them as linked lists for format compatibility.
+static std::vector<short> GetActiveLinks(const std::vector<short>& activeNumbers, int count, short& firstNumber)
+{
+	auto links = std::vector<short>(count, NO_ITEM);
+	short prevNumber = NO_ITEM;
+	firstNumber = NO_ITEM;
+
+	for (short number : activeNumbers)
+	{
+		if (number == NO_ITEM)
+			continue;
+
+		if (prevNumber == NO_ITEM)
+			firstNumber = number;
+		else
+			links[prevNumber] = number;
+
+		prevNumber = number;
+	}
+
+	return links;
+}
+
 void SaveGame::LoadSavegameInfos()
 {
 	for (int i = 0; i < SAVEGAME_MAX; i++)
@@ -504,6 +527,9 @@ bool SaveGame::Save(int slot)
 	}
 	auto roomOffset = fbb.CreateVector(rooms);
 
+	short firstActiveItem = NO_ITEM;
+	auto activeItemLinks = GetActiveLinks(ActiveItems, (int)g_Level.Items.size(), firstActiveItem);
+
 	int currentItemIndex = 0;
 	for (auto& itemToSerialize : g_Level.Items) 
 	{
@@ -667,7 +693,7 @@ bool SaveGame::Save(int slot)
 			serializedItem.add_anim_number(itemToSerialize.Animation.AnimNumber - Objects[itemToSerialize.ObjectNumber].animIndex);
 
 		serializedItem.add_next_item(itemToSerialize.NextItem);
-		serializedItem.add_next_item_active(itemToSerialize.NextActive);
+		serializedItem.add_next_item_active(activeItemLinks[itemToSerialize.Index]);
 		serializedItem.add_after_death(itemToSerialize.AfterDeath);
 		serializedItem.add_box_number(itemToSerialize.BoxNumber);
 		serializedItem.add_carried_item(itemToSerialize.CarriedItem);
@@ -757,6 +783,9 @@ bool SaveGame::Save(int slot)
 	// TODO: In future, we should save only active FX, not whole array.
 	// This may come together with Monty's branch merge -- Lwmte, 10.07.22
 
+	short firstActiveEffect = NO_ITEM;
+	auto activeEffectLinks = GetActiveLinks(ActiveEffects, NUM_EFFECTS, firstActiveEffect);
+
 	std::vector<flatbuffers::Offset<Save::FXInfo>> serializedEffects{};
 	for (auto& effectToSerialize : EffectList)
 	{
@@ -766,7 +795,7 @@ bool SaveGame::Save(int slot)
 		serializedEffect.add_room_number(effectToSerialize.roomNumber);
 		serializedEffect.add_object_number(effectToSerialize.objectNumber);
 		serializedEffect.add_next_fx(effectToSerialize.nextFx);
-		serializedEffect.add_next_active(effectToSerialize.nextActive);
+		serializedEffect.add_next_active(activeEffectLinks[&effectToSerialize - EffectList]);
 		serializedEffect.add_speed(effectToSerialize.speed);
 		serializedEffect.add_fall_speed(effectToSerialize.fallspeed);
 		serializedEffect.add_frame_number(effectToSerialize.frameNumber);
@@ -1263,11 +1292,11 @@ bool SaveGame::Save(int slot)
 	sgb.add_lara(laraOffset);
 	sgb.add_rooms(roomOffset);
 	sgb.add_next_item_free(NextItemFree);
-	sgb.add_next_item_active(NextItemActive);
+	sgb.add_next_item_active(firstActiveItem);
 	sgb.add_items(serializedItemsOffset);
 	sgb.add_fxinfos(serializedEffectsOffset);
 	sgb.add_next_fx_free(NextFxFree);
-	sgb.add_next_fx_active(NextFxActive);
+	sgb.add_next_fx_active(firstActiveEffect);
 	sgb.add_soundtracks(soundtrackOffset);
 	sgb.add_cd_flags(soundtrackMapOffset);
 	sgb.add_action_queue(actionQueueOffset);
@@ -1494,8 +1523,11 @@ bool SaveGame::Load(int slot)
 
 	ZeroMemory(&Lara, sizeof(LaraInfo));
 
+	// Item pool may have grown during play; restore it to saved size before links are read.
+	if (s->items()->size() > g_Level.Items.size())
+		GrowItemArray(s->items()->size());
+
 	NextItemFree = s->next_item_free();
-	NextItemActive = s->next_item_active();
 
 	for(int i = 0; i < s->room_items()->size(); ++i)
 		g_Level.Rooms[i].itemNumber = s->room_items()->Get(i);
@@ -1510,7 +1542,7 @@ bool SaveGame::Load(int slot)
 		item->ObjectNumber = GAME_OBJECT_ID(savedItem->object_id());
 
 		item->NextItem = savedItem->next_item();
-		item->NextActive = savedItem->next_item_active();
+		item->ActiveSlot = NO_ITEM;
 
 		if (item->ObjectNumber == GAME_OBJECT_ID::ID_NO_OBJECT)
 			continue;
@@ -1735,6 +1767,15 @@ bool SaveGame::Load(int slot)
 		}
 	}
 
+	ActiveItems.clear();
+	for (short itemNumber = s->next_item_active();
+		 itemNumber != NO_ITEM && ActiveItems.size() < s->items()->size();
+		 itemNumber = s->items()->Get(itemNumber)->next_item_active())
+	{
+		g_Level.Items[itemNumber].ActiveSlot = (int)ActiveItems.size();
+		ActiveItems.push_back(itemNumber);
+	}
+
 	for (int i = 0; i < s->particles()->size(); i++)
 	{
 		auto* particleInfo = s->particles()->Get(i);
@@ -1824,7 +1865,6 @@ bool SaveGame::Load(int slot)
 	}
 
 	NextFxFree = s->next_fx_free();
-	NextFxActive = s->next_fx_active();
 
 	for (int i = 0; i < s->fxinfos()->size(); ++i)
 	{
@@ -1834,7 +1874,7 @@ bool SaveGame::Load(int slot)
 		fx.roomNumber = fx_saved->room_number();
 		fx.objectNumber = fx_saved->object_number();
 		fx.nextFx = fx_saved->next_fx();
-		fx.nextActive = fx_saved->next_active();
+		fx.activeSlot = NO_ITEM;
 		fx.speed = fx_saved->speed();
 		fx.fallspeed = fx_saved->fall_speed();
 		fx.frameNumber = fx_saved->frame_number();
@@ -1844,6 +1884,15 @@ bool SaveGame::Load(int slot)
 		fx.flag2 = fx_saved->flag2();
 	}
 
+	ActiveEffects.clear();
+	for (short fxNumber = s->next_fx_active();
+		 fxNumber != NO_ITEM && ActiveEffects.size() < s->fxinfos()->size();
+		 fxNumber = s->fxinfos()->Get(fxNumber)->next_active())
+	{
+		EffectList[fxNumber].activeSlot = (short)ActiveEffects.size();
+		ActiveEffects.push_back(fxNumber);
+	}
+
 	if (g_Level.EventSets.size() == s->call_counters()->size())
 	{
 		for (int i = 0; i < s->call_counters()->size(); ++i)
@@ -2053,6 +2102,7 @@ bool SaveGame::Load(int slot)
 
 		rope->coiled = s->rope()->coiled();
 		rope->active = s->rope()->active();
+		rope->attached = true;
 
 		rope->position = ToVector3i(s->rope()->position());
 		CurrentPendulum.position = ToVector3i(s->pendulum()->position());
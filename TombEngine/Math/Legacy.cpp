@@ -1,18 +1,166 @@
 #include "framework.h"
 #include "Math/Legacy.h"
 
+#include <chrono>
+#include <random>
+#include <spdlog/fmt/fmt.h>
+
+// Angle domain is only 65536 values, so sine is tabulated exactly for every short angle.
+// Cosine reads from same table offset by a quarter turn.
+constexpr auto SIN_TABLE_SIZE		= 65536;
+constexpr auto SIN_TABLE_QUARTER	= SIN_TABLE_SIZE / 4;
+constexpr auto ATAN_TABLE_SIZE		= 2048;
+constexpr auto SHORT_ANGLE_HALF_PI	= 16384.0f;
+constexpr auto SHORT_ANGLE_PI		= 32768.0f;
+
+// Tables are built on first use, so they are valid even if angles are computed during static initialization.
+static const std::array<float, SIN_TABLE_SIZE>& GetSinTable()
+{
+	static const auto table = []()
+	{
+		auto table = std::array<float, SIN_TABLE_SIZE>{};
+		for (int i = 0; i < SIN_TABLE_SIZE; i++)
+			table[i] = (float)sin(i * (PI_MUL_2 / (double)SIN_TABLE_SIZE));
+
+		return table;
+	}();
+
+	return table;
+}
+
+// atan(t) for t in [0, 1], expressed in short angle units. Interpolated linearly; max error is far below one unit.
+static const std::array<float, ATAN_TABLE_SIZE + 1>& GetAtanTable()
+{
+	static const auto table = []()
+	{
+		auto table = std::array<float, ATAN_TABLE_SIZE + 1>{};
+		for (int i = 0; i <= ATAN_TABLE_SIZE; i++)
+			table[i] = (float)(atan(i / (double)ATAN_TABLE_SIZE) * (SHORT_ANGLE_PI / (double)PI));
+
+		return table;
+	}();
+
+	return table;
+}
+
+static float GetAtanUnits(float ratio)
+{
+	float pos = ratio * ATAN_TABLE_SIZE;
+	int index = std::min((int)pos, ATAN_TABLE_SIZE - 1);
+	float alpha = pos - index;
+
+	const auto& table = GetAtanTable();
+	return (table[index] + (table[index + 1] - table[index]) * alpha);
+}
+
+// Returns atan2(y, x) in short angle units, before truncation.
+static float GetAtan2Units(float y, float x)
+{
+	float absX = abs(x);
+	float absY = abs(y);
+
+	if (absX == 0.0f && absY == 0.0f)
+		return 0.0f;
+
+	float angle = (absX >= absY) ?
+		GetAtanUnits(absY / absX) :
+		(SHORT_ANGLE_HALF_PI - GetAtanUnits(absX / absY));
+
+	if (x < 0.0f)
+		angle = SHORT_ANGLE_PI - angle;
+
+	return ((y < 0.0f) ? -angle : angle);
+}
+
 float phd_sin(short x)
 {
-	return sin(TO_RAD(x));
+	return GetSinTable()[(unsigned short)x];
 }
 
 float phd_cos(short x)
 {
-	return cos(TO_RAD(x));
+	return GetSinTable()[(unsigned short)(x + SIN_TABLE_QUARTER)];
 }
 
 // NOTE: Order of parameters is inverted!
 int phd_atan(int y, int x)
 {
-	return FROM_RAD(atan2(x, y));
+	// Truncate towards zero and wrap +PI to -PI, same as FROM_RAD().
+	return (short)(int)GetAtan2Units((float)x, (float)y);
+}
+
+// Compares tables against libm versions they replaced and logs max error and timing.
+bool BenchmarkLegacyTrig()
+{
+	constexpr auto ATAN_SAMPLE_COUNT	 = 1 << 20;
+	constexpr auto SIN_ITERATION_COUNT	 = 64;
+	constexpr auto SIN_ERROR_MAX		 = 1e-5f;
+	constexpr auto ATAN_ERROR_UNITS_MAX	 = 1;
+
+	// Reference implementations are those used before tables.
+	auto refSin = [](short x) { return (float)sin(TO_RAD(x)); };
+	auto refCos = [](short x) { return (float)cos(TO_RAD(x)); };
+	auto refAtan = [](int y, int x) { return (int)FROM_RAD(atan2(x, y)); };
+
+	float sinErrorMax = 0.0f;
+	for (int i = 0; i < SIN_TABLE_SIZE; i++)
+	{
+		sinErrorMax = std::max(sinErrorMax, abs(phd_sin((short)i) - refSin((short)i)));
+		sinErrorMax = std::max(sinErrorMax, abs(phd_cos((short)i) - refCos((short)i)));
+	}
+
+	// Fixed seed keeps report reproducible between runs and compilers.
+	auto generator = std::mt19937(SIN_TABLE_SIZE);
+	auto distribution = std::uniform_int_distribution<int>(-SIN_TABLE_SIZE, SIN_TABLE_SIZE);
+
+	auto atanInputs = std::vector<std::pair<int, int>>(ATAN_SAMPLE_COUNT);
+	for (auto& input : atanInputs)
+		input = std::pair(distribution(generator), distribution(generator));
+
+	int atanErrorMax = 0;
+	int atanMismatchCount = 0;
+	for (const auto& [y, x] : atanInputs)
+	{
+		int error = abs((short)(phd_atan(y, x) - refAtan(y, x)));
+		atanErrorMax = std::max(atanErrorMax, error);
+		if (error != 0)
+			atanMismatchCount++;
+	}
+
+	auto measureSin = [&](auto sinFunction)
+	{
+		volatile float sum = 0.0f;
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int j = 0; j < SIN_ITERATION_COUNT; j++)
+		{
+			for (int i = 0; i < SIN_TABLE_SIZE; i++)
+				sum = sum + sinFunction((short)i);
+		}
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		return (std::chrono::duration<double, std::nano>(endTime - startTime).count() / (SIN_ITERATION_COUNT * SIN_TABLE_SIZE));
+	};
+
+	auto measureAtan = [&](auto atanFunction)
+	{
+		volatile int sum = 0;
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (const auto& [y, x] : atanInputs)
+			sum = sum + atanFunction(y, x);
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		return (std::chrono::duration<double, std::nano>(endTime - startTime).count() / ATAN_SAMPLE_COUNT);
+	};
+
+	double sinTime = measureSin([](short x) { return phd_sin(x); });
+	double refSinTime = measureSin(refSin);
+	double atanTime = measureAtan([](int y, int x) { return phd_atan(y, x); });
+	double refAtanTime = measureAtan(refAtan);
+
+	TENLog(fmt::format("phd_sin/phd_cos: max error {:.3g}, {:.2f} ns per call (libm {:.2f} ns).",
+		sinErrorMax, sinTime, refSinTime), LogLevel::Info);
+	TENLog(fmt::format("phd_atan: max error {} units in {} of {} samples, {:.2f} ns per call (libm {:.2f} ns).",
+		atanErrorMax, atanMismatchCount, ATAN_SAMPLE_COUNT, atanTime, refAtanTime), LogLevel::Info);
+
+	return (sinErrorMax <= SIN_ERROR_MAX && atanErrorMax <= ATAN_ERROR_UNITS_MAX);
 }
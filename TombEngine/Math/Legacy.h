@@ -42,3 +42,5 @@ constexpr float TO_RAD(short shortAngle)
 float phd_sin(short x);
 float phd_cos(short x);
 int	  phd_atan(int y, int x);
+
+bool BenchmarkLegacyTrig();
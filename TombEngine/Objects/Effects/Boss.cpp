@@ -81,7 +81,7 @@ namespace TEN::Effects::Boss
 		SoundEffect(SFX_TR3_BLAST_CIRCLE, &shockwaveItem.Pose);
 	}
 
-	void ShieldControl(int itemNumber)
+	void ShieldControl(short itemNumber)
 	{
 		auto& item = g_Level.Items[itemNumber];
 
@@ -102,7 +102,7 @@ namespace TEN::Effects::Boss
 	}
 
 	// NOTE: Ring and explosion wave rotate and scale by default.
-	void ShockwaveRingControl(int itemNumber)
+	void ShockwaveRingControl(short itemNumber)
 	{
 		auto& item = g_Level.Items[itemNumber];
 
@@ -128,7 +128,7 @@ namespace TEN::Effects::Boss
 		UpdateItemRoom(itemNumber);
 	}
 
-	void ShockwaveExplosionControl(int itemNumber)
+	void ShockwaveExplosionControl(short itemNumber)
 	{
 		auto& item = g_Level.Items[itemNumber];
 
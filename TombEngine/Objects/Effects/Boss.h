@@ -23,9 +23,9 @@ namespace TEN::Effects::Boss
 		Lizard             = (1 << 2)
 	};
 
-	void ShieldControl(int itemNumber);
-	void ShockwaveRingControl(int itemNumber);
-	void ShockwaveExplosionControl(int itemNumber);
+	void ShieldControl(short itemNumber);
+	void ShockwaveRingControl(short itemNumber);
+	void ShockwaveExplosionControl(short itemNumber);
 
 	void ExplodeBoss(int itemNumber, ItemInfo& item, int deathCountToDie, const Vector4& color, const Vector4& explosionColor1, const Vector4& explosionColor2, bool allowExplosion = true);
 	void CheckForRequiredObjects(ItemInfo& item);
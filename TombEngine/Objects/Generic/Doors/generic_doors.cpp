@@ -414,7 +414,7 @@ namespace TEN::Entities::Doors
 		if (floor)
 		{
 			floor->Box = NO_BOX;
-			floor->TriggerIndex = 0;
+			floor->TriggerIndex = NO_TRIGGER;
 
 			// FIXME: HACK!!!!!!!
 			// We should find a better way of dealing with doors using new floordata.
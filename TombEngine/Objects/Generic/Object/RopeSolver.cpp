@@ -0,0 +1,178 @@
+#include "framework.h"
+#include "Objects/Generic/Object/RopeSolver.h"
+
+namespace TEN::Entities::Generic
+{
+	int RopeSolver::GetRopeCount() const
+	{
+		return (int)m_ropes.size();
+	}
+
+	int RopeSolver::GetSegmentCount() const
+	{
+		return m_segmentCount;
+	}
+
+	bool RopeSolver::IsRopeAwake(int ropeIndex) const
+	{
+		return m_ropes[ropeIndex].IsAwake;
+	}
+
+	const Vector3* RopeSolver::GetPositions(int ropeIndex) const
+	{
+		return &m_positions[ropeIndex * m_segmentCount];
+	}
+
+	// Velocities are per frame, as implied by distance to previous positions.
+	void RopeSolver::GetState(int ropeIndex, Vector3* positions, Vector3* velocities) const
+	{
+		int start = ropeIndex * m_segmentCount;
+		for (int i = 0; i < m_segmentCount; i++)
+		{
+			positions[i] = m_positions[start + i];
+			velocities[i] = m_positions[start + i] - m_prevPositions[start + i];
+		}
+	}
+
+	void RopeSolver::SetState(int ropeIndex, const Vector3* positions, const Vector3* velocities)
+	{
+		int start = ropeIndex * m_segmentCount;
+		for (int i = 0; i < m_segmentCount; i++)
+		{
+			m_positions[start + i] = positions[i];
+			m_prevPositions[start + i] = positions[i] - velocities[i];
+		}
+
+		// Rope may have been moved from outside, so it has to settle again before sleeping.
+		m_ropes[ropeIndex].SettledFrameCount = 0;
+	}
+
+	void RopeSolver::RequestStep(int ropeIndex)
+	{
+		m_ropes[ropeIndex].IsStepRequested = true;
+	}
+
+	void RopeSolver::ClearVerticalVelocity(int ropeIndex)
+	{
+		int start = ropeIndex * m_segmentCount;
+		for (int i = start; i < (start + m_segmentCount); i++)
+			m_prevPositions[i].y = m_positions[i].y;
+	}
+
+	void RopeSolver::Initialize(int segmentCount)
+	{
+		m_segmentCount = segmentCount;
+
+		m_ropes.clear();
+		m_positions.clear();
+		m_prevPositions.clear();
+		m_awakeRopes.clear();
+	}
+
+	// New rope starts with all segments at origin; pose is expected to be set with SetState().
+	int RopeSolver::AddRope(const Vector3& origin, float segmentLength)
+	{
+		int ropeIndex = (int)m_ropes.size();
+
+		auto rope = Rope{};
+		rope.Origin = origin;
+		rope.SegmentLength = segmentLength;
+		m_ropes.push_back(rope);
+
+		m_positions.resize(m_positions.size() + m_segmentCount, Vector3::Zero);
+		m_prevPositions.resize(m_prevPositions.size() + m_segmentCount, Vector3::Zero);
+
+		return ropeIndex;
+	}
+
+	// Only ropes requested since last step, close to wake origin and not yet at rest are simulated.
+	// Others keep their last pose until they are requested near wake origin again.
+	void RopeSolver::Step(const Vector3& wakeOrigin, float wakeRadius)
+	{
+		m_awakeRopes.clear();
+		for (int i = 0; i < m_ropes.size(); i++)
+		{
+			auto& rope = m_ropes[i];
+
+			rope.IsAwake = rope.IsStepRequested &&
+						   rope.SettledFrameCount < SETTLE_FRAME_COUNT &&
+						   Vector3::DistanceSquared(rope.Origin, wakeOrigin) <= (wakeRadius * wakeRadius);
+			rope.IsStepRequested = false;
+
+			if (rope.IsAwake)
+				m_awakeRopes.push_back(i);
+		}
+
+		for (int ropeIndex : m_awakeRopes)
+			Integrate(ropeIndex);
+
+		for (int ropeIndex : m_awakeRopes)
+			SolveConstraints(ropeIndex);
+
+		for (int ropeIndex : m_awakeRopes)
+			UpdateSettling(ropeIndex);
+	}
+
+	void RopeSolver::Integrate(int ropeIndex)
+	{
+		int start = ropeIndex * m_segmentCount;
+
+		// First segment is pinned to origin.
+		for (int i = start + 1; i < (start + m_segmentCount); i++)
+		{
+			auto velocity = m_positions[i] - m_prevPositions[i];
+			velocity.x *= HORIZONTAL_DRAG;
+			velocity.y += GRAVITY;
+			velocity.z *= HORIZONTAL_DRAG;
+
+			m_prevPositions[i] = m_positions[i];
+			m_positions[i] += velocity;
+		}
+	}
+
+	void RopeSolver::SolveConstraints(int ropeIndex)
+	{
+		auto* positions = &m_positions[ropeIndex * m_segmentCount];
+		float segmentLength = m_ropes[ropeIndex].SegmentLength;
+
+		for (int iteration = 0; iteration < CONSTRAINT_ITERATIONS; iteration++)
+		{
+			for (int i = 0; i < (m_segmentCount - 1); i++)
+			{
+				auto delta = positions[i + 1] - positions[i];
+
+				float distance = delta.Length();
+				if (distance == 0.0f)
+					continue;
+
+				auto correction = delta * ((distance - segmentLength) / distance);
+
+				// Pinned first segment doesn't move, so its neighbour takes whole correction.
+				if (i == 0)
+				{
+					positions[i + 1] -= correction;
+				}
+				else
+				{
+					positions[i] += correction * 0.5f;
+					positions[i + 1] -= correction * 0.5f;
+				}
+			}
+		}
+	}
+
+	void RopeSolver::UpdateSettling(int ropeIndex)
+	{
+		int start = ropeIndex * m_segmentCount;
+
+		float maxSpeedSqr = 0.0f;
+		for (int i = start; i < (start + m_segmentCount); i++)
+			maxSpeedSqr = std::max(maxSpeedSqr, Vector3::DistanceSquared(m_positions[i], m_prevPositions[i]));
+
+		auto& rope = m_ropes[ropeIndex];
+		if (maxSpeedSqr < (SETTLE_SPEED * SETTLE_SPEED))
+			rope.SettledFrameCount++;
+		else
+			rope.SettledFrameCount = 0;
+	}
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+namespace TEN::Entities::Generic
+{
+	// Verlet solver for free hanging ropes. Segment positions are relative to rope origin, with first segment pinned to it.
+	// Positions and previous positions of all ropes are stored in packed arrays, rope after rope.
+	class RopeSolver
+	{
+	private:
+		// Constants
+		static constexpr auto GRAVITY				= 3.0f;
+		static constexpr auto HORIZONTAL_DRAG		= 15.0f / 16.0f;
+		static constexpr auto CONSTRAINT_ITERATIONS	= 8;
+		static constexpr auto SETTLE_SPEED			= 0.05f; // Max segment movement per frame for rope to count as resting.
+		static constexpr auto SETTLE_FRAME_COUNT	= 30;
+
+		struct Rope
+		{
+			Vector3 Origin		  = Vector3::Zero; // World position, used for distance to wake origin.
+			float	SegmentLength = 0.0f;
+
+			int	 SettledFrameCount = 0;
+			bool IsStepRequested   = false;
+			bool IsAwake		   = false;
+		};
+
+		std::vector<Rope>	 m_ropes		 = {};
+		std::vector<Vector3> m_positions	 = {};
+		std::vector<Vector3> m_prevPositions = {};
+		std::vector<int>	 m_awakeRopes	 = {}; // Scratch list of ropes stepped in current batch.
+		int					 m_segmentCount	 = 0;
+
+	public:
+		// Getters
+		int			   GetRopeCount() const;
+		int			   GetSegmentCount() const;
+		bool		   IsRopeAwake(int ropeIndex) const;
+		const Vector3* GetPositions(int ropeIndex) const;
+		void		   GetState(int ropeIndex, Vector3* positions, Vector3* velocities) const;
+
+		// Setters
+		void SetState(int ropeIndex, const Vector3* positions, const Vector3* velocities);
+		void RequestStep(int ropeIndex);
+		void ClearVerticalVelocity(int ropeIndex);
+
+		// Utilities
+		void Initialize(int segmentCount);
+		int	 AddRope(const Vector3& origin, float segmentLength);
+		void Step(const Vector3& wakeOrigin, float wakeRadius);
+
+	private:
+		// Helpers
+		void Integrate(int ropeIndex);
+		void SolveConstraints(int ropeIndex);
+		void UpdateSettling(int ropeIndex);
+	};
+}
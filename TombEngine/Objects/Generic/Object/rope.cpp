@@ -19,11 +19,68 @@ using namespace TEN::Input;
 
 namespace TEN::Entities::Generic
 {
+	constexpr auto ROPE_WAKE_DISTANCE = BLOCK(8);
+	constexpr auto ROPE_FP_SCALE	  = (float)(1 << FP_SHIFT);
+
 	PENDULUM CurrentPendulum;
 	PENDULUM AlternatePendulum;
 	std::vector<ROPE_STRUCT> Ropes;
 	int RopeSwing = 0;
 
+	RopeSolver FreeRopeSolver = {};
+
+	// Rebuilds fixed-point mesh used by renderer and collision from solver positions.
+	// Mesh follows segment directions with exact segment length, same as pendulum model.
+	static void UpdateRopeMesh(int ropeIndex)
+	{
+		auto& rope = Ropes[ropeIndex];
+		const auto* positions = FreeRopeSolver.GetPositions(ropeIndex);
+		float segmentLength = rope.segmentLength / ROPE_FP_SCALE;
+
+		auto meshPos = positions[0];
+		rope.meshSegment[0] = Vector3i(meshPos * ROPE_FP_SCALE);
+
+		for (int i = 0; i < (ROPE_SEGMENTS - 1); i++)
+		{
+			auto direction = positions[i + 1] - positions[i];
+			direction.Normalize();
+
+			meshPos += direction * segmentLength;
+			rope.normalisedSegment[i] = Vector3i(direction * ROPE_FP_SCALE);
+			rope.meshSegment[i + 1] = Vector3i(meshPos * ROPE_FP_SCALE);
+		}
+	}
+
+	static void ImportRopeState(int ropeIndex)
+	{
+		const auto& rope = Ropes[ropeIndex];
+
+		Vector3 positions[ROPE_SEGMENTS];
+		Vector3 velocities[ROPE_SEGMENTS];
+		for (int i = 0; i < ROPE_SEGMENTS; i++)
+		{
+			positions[i] = rope.segment[i].ToVector3() / ROPE_FP_SCALE;
+			velocities[i] = rope.velocity[i].ToVector3() / ROPE_FP_SCALE;
+		}
+
+		FreeRopeSolver.SetState(ropeIndex, positions, velocities);
+	}
+
+	static void ExportRopeState(int ropeIndex)
+	{
+		auto& rope = Ropes[ropeIndex];
+
+		Vector3 positions[ROPE_SEGMENTS];
+		Vector3 velocities[ROPE_SEGMENTS];
+		FreeRopeSolver.GetState(ropeIndex, positions, velocities);
+
+		for (int i = 0; i < ROPE_SEGMENTS; i++)
+		{
+			rope.segment[i] = Vector3i(positions[i] * ROPE_FP_SCALE);
+			rope.velocity[i] = Vector3i(velocities[i] * ROPE_FP_SCALE);
+		}
+	}
+
 	void InitializeRope(short itemNumber)
 	{
 		auto* item = &g_Level.Items[itemNumber];
@@ -41,6 +98,29 @@ namespace TEN::Entities::Generic
 		item->TriggerFlags = short(Ropes.size());
 
 		Ropes.push_back(rope);
+
+		FreeRopeSolver.AddRope(itemPos.ToVector3(), rope.segmentLength / ROPE_FP_SCALE);
+		ImportRopeState(item->TriggerFlags);
+		UpdateRopeMesh(item->TriggerFlags);
+	}
+
+	void ClearRopes()
+	{
+		Ropes.clear();
+		FreeRopeSolver.Initialize(ROPE_SEGMENTS);
+	}
+
+	// Steps all free ropes requested by their items this frame in one batch.
+	// Ropes far from player or already at rest are put to sleep and keep their last pose.
+	void UpdateRopes()
+	{
+		FreeRopeSolver.Step(LaraItem->Pose.Position.ToVector3(), ROPE_WAKE_DISTANCE);
+
+		for (int i = 0; i < Ropes.size(); i++)
+		{
+			if (!Ropes[i].attached && FreeRopeSolver.IsRopeAwake(i))
+				UpdateRopeMesh(i);
+		}
 	}
 
 	void PrepareRope(ROPE_STRUCT* rope, Vector3i* pos1, Vector3i* pos2, int length, ItemInfo* item)
@@ -82,6 +162,7 @@ namespace TEN::Entities::Generic
 		}
 
 		rope->active = 0;
+		rope->attached = false;
 	}
 
 	Vector3i* NormaliseRopeVector(Vector3i* vec)
@@ -155,10 +236,42 @@ namespace TEN::Entities::Generic
 		if (TriggerActive(item))
 		{
 			rope->active = 1;
-			RopeDynamics(rope);
+
+			// Rope held by player keeps original fixed-point pendulum model.
+			bool isHeld = (Lara.Control.Rope.Ptr == item->TriggerFlags);
+			if (isHeld && !rope->attached)
+			{
+				ExportRopeState(item->TriggerFlags);
+				rope->attached = true;
+			}
+
+			if (rope->attached)
+			{
+				// Pendulum runs once more after release to hand velocity back to rope.
+				RopeDynamics(rope);
+
+				if (!isHeld)
+				{
+					ImportRopeState(item->TriggerFlags);
+					rope->attached = false;
+				}
+			}
+			else
+			{
+				if (rope->coiled)
+				{
+					rope->coiled--;
+					if (!rope->coiled)
+						FreeRopeSolver.ClearVerticalVelocity(item->TriggerFlags);
+				}
+
+				FreeRopeSolver.RequestStep(item->TriggerFlags);
+			}
 		}
 		else
+		{
 			rope->active = 0;
+		}
 	}
 
 	void RopeCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* coll)
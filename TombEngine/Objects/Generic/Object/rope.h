@@ -1,4 +1,5 @@
 #pragma once
+#include "Objects/Generic/Object/RopeSolver.h"
 
 struct ItemInfo;
 struct CollisionInfo;
@@ -30,6 +31,7 @@ namespace TEN::Entities::Generic
 		int segmentLength;
 		short active;
 		short coiled;
+		bool attached; // State is in fixed-point arrays and driven by pendulum while player holds rope.
 	};
 
 	struct PENDULUM
@@ -44,8 +46,11 @@ namespace TEN::Entities::Generic
 	extern PENDULUM AlternatePendulum;
 	extern std::vector<ROPE_STRUCT> Ropes;
 	extern int RopeSwing;
+	extern RopeSolver FreeRopeSolver;
 
 	void InitializeRope(short itemNumber);
+	void ClearRopes();
+	void UpdateRopes();
 	void PrepareRope(ROPE_STRUCT* rope, Vector3i* pos1, Vector3i* pos2, int length, ItemInfo* item);
 	Vector3i* NormaliseRopeVector(Vector3i* vec);
 	void GetRopePos(ROPE_STRUCT* rope, int segmentFrame, int* x, int* y, int* z);
@@ -35,7 +35,7 @@ namespace TEN::Entities::Switches
 	{
 		auto* lara = GetLaraInfo(laraItem);
 		auto* switchItem = &g_Level.Items[itemNum];
-		auto* triggerIndex = GetTriggerIndex(switchItem);
+		const auto* trigger = GetTrigger(switchItem);
 
 		int targetItemNum;
 		ItemInfo* target = nullptr;
@@ -45,10 +45,10 @@ namespace TEN::Entities::Switches
 		// attach it to cog. If no object found or object is not door,
 		// bypass further processing and do ordinary object collision.
 
-		if (triggerIndex)
+		if (trigger != nullptr && trigger->ActionCount > 1)
 		{
-			short* trigger = triggerIndex;
-			targetItemNum = trigger[3] & VALUE_BITS;
+			// First action is switch itself.
+			targetItemNum = GetTriggerAction(*trigger, 1).Value;
 
 			if (targetItemNum < g_Level.Items.size())
 			{
@@ -230,12 +230,8 @@ void PuzzleDoneCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* co
 	auto& player = GetLaraInfo(*laraItem);
 
 	// NOTE: Only execute code below if Triggertype is switch trigger.
-	short* triggerIndexPtr = GetTriggerIndex(&receptacleItem);
-	if (triggerIndexPtr == nullptr)
-		return;
-
-	int triggerType = (*(triggerIndexPtr++) >> 8) & TRIGGER_BITS;
-	if (triggerType != TRIGGER_TYPES::SWITCH)
+	const auto* trigger = GetTrigger(&receptacleItem);
+	if (trigger == nullptr || trigger->Type != TRIGGER_TYPES::SWITCH)
 		return;
 
 	AnimateItem(&receptacleItem);
@@ -329,8 +325,8 @@ void PuzzleDoneCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* co
 
 void PuzzleDone(ItemInfo* item, short itemNumber)
 {
-	short* triggerIndexPtr = GetTriggerIndex(item);
-	short triggerType = (triggerIndexPtr != nullptr) ? (*(triggerIndexPtr++) >> 8) & TRIGGER_BITS : TRIGGER_TYPES::TRIGGER;
+	const auto* trigger = GetTrigger(item);
+	short triggerType = (trigger != nullptr) ? trigger->Type : TRIGGER_TYPES::TRIGGER;
 
 	if (triggerType == TRIGGER_TYPES::SWITCH)
 	{
@@ -440,12 +436,11 @@ void KeyHoleCollision(short itemNumber, ItemInfo* laraItem, CollisionInfo* coll)
 	auto* keyHoleItem = &g_Level.Items[itemNumber];
 	auto* player = GetLaraInfo(laraItem);
 
-	short* triggerIndexPtr = GetTriggerIndex(keyHoleItem);
-
-	if (triggerIndexPtr == nullptr)
+	const auto* trigger = GetTrigger(keyHoleItem);
+	if (trigger == nullptr)
 		return;
 
-	short triggerType = (*(triggerIndexPtr++) >> 8) & TRIGGER_BITS;
+	short triggerType = trigger->Type;
 
 	bool isActionReady = (IsHeld(In::Action) || g_Gui.GetInventoryItemChosen() != NO_ITEM);
 
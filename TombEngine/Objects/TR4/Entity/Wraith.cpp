@@ -698,24 +698,17 @@ namespace TEN::Entities::TR4
 
 	void KillWraith(ItemInfo* item)
 	{
-		ItemInfo* item2 = nullptr;
-
-		if (NextItemActive != NO_ITEM)
+		for (short itemNumber : ActiveItems)
 		{
-			for (; NextItemActive != NO_ITEM;)
-			{
-				auto* item2 = &g_Level.Items[NextItemActive];
-				if (item2->ObjectNumber == ID_WRAITH3 && !item2->HitPoints)
-					break;
+			if (itemNumber == NO_ITEM)
+				continue;
 
-				if (item2->NextActive == NO_ITEM)
-				{
-					FlipEffect = -1;
-					return;
-				}
+			auto* item2 = &g_Level.Items[itemNumber];
+			if (item2->ObjectNumber == ID_WRAITH3 && !item2->HitPoints)
+			{
+				item2->HitPoints = item - g_Level.Items.data();
+				break;
 			}
-
-			item2->HitPoints = item - g_Level.Items.data();
 		}
 
 		FlipEffect = -1;
@@ -134,7 +134,7 @@ void InitPickup(ObjectInfo* object, int objectNumber)
 	}
 }
 
-void InitPickup(ObjectInfo* object, int objectNumber, std::function<ControlFunction> func)
+void InitPickup(ObjectInfo* object, int objectNumber, ObjectControlFunction* func)
 {
 	object = &Objects[objectNumber];
 	if (object->loaded)
@@ -162,7 +162,7 @@ void InitFlare(ObjectInfo* object, int objectNumber)
 	}
 }
 
-void InitProjectile(ObjectInfo* object, std::function<InitFunction> func, int objectNumber, bool noLoad)
+void InitProjectile(ObjectInfo* object, ObjectControlFunction* func, int objectNumber, bool noLoad)
 {
 	object = &Objects[objectNumber];
 	if (object->loaded || noLoad)
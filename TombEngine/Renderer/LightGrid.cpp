@@ -0,0 +1,240 @@
+#include "framework.h"
+#include "Renderer/LightGrid.h"
+
+#include <array>
+#include <chrono>
+#include <random>
+
+#include "Math/Math.h"
+
+namespace TEN::Renderer
+{
+	constexpr auto LIGHT_GRID_CELL_SIZE		 = BLOCK(4);
+	constexpr auto LIGHT_GRID_MAX_AXIS_CELLS = 64;
+
+	void LightGrid::Build(const std::vector<RendererLight>& lights, const Vector3& boundsMin, const Vector3& boundsMax)
+	{
+		float extentX = std::max(boundsMax.x - boundsMin.x, 0.0f);
+		float extentZ = std::max(boundsMax.z - boundsMin.z, 0.0f);
+
+		// Grow cells for very large volumes, so grid never exceeds fixed cell count.
+		m_cellSize = std::max((float)LIGHT_GRID_CELL_SIZE, std::max(extentX, extentZ) / LIGHT_GRID_MAX_AXIS_CELLS);
+		m_originX = boundsMin.x;
+		m_originZ = boundsMin.z;
+		m_sizeX = std::clamp((int)ceil(extentX / m_cellSize), 1, LIGHT_GRID_MAX_AXIS_CELLS);
+		m_sizeZ = std::clamp((int)ceil(extentZ / m_cellSize), 1, LIGHT_GRID_MAX_AXIS_CELLS);
+
+		m_offsets.assign((m_sizeX * m_sizeZ) + 1, 0);
+		m_lightStamps.assign(lights.size(), 0);
+		m_stamp = 0;
+
+		// First pass counts lights per cell, second pass fills them in.
+		for (int pass = 0; pass < 2; pass++)
+		{
+			if (pass == 1)
+			{
+				for (int i = 1; i < m_offsets.size(); i++)
+					m_offsets[i] += m_offsets[i - 1];
+
+				m_lightIndices.resize(m_offsets.back());
+			}
+
+			for (int i = 0; i < lights.size(); i++)
+			{
+				const auto& light = lights[i];
+
+				int minX = GetCellX(light.Position.x - light.Out);
+				int maxX = GetCellX(light.Position.x + light.Out);
+				int minZ = GetCellZ(light.Position.z - light.Out);
+				int maxZ = GetCellZ(light.Position.z + light.Out);
+
+				for (int x = minX; x <= maxX; x++)
+				{
+					for (int z = minZ; z <= maxZ; z++)
+					{
+						int cell = (x * m_sizeZ) + z;
+
+						if (pass == 0)
+							m_offsets[cell + 1]++;
+						else
+							m_lightIndices[m_offsets[cell]++] = i;
+					}
+				}
+			}
+		}
+
+		// Fill pass advanced every offset to start of next cell; shift them back.
+		for (int i = (int)m_offsets.size() - 1; i > 0; i--)
+			m_offsets[i] = m_offsets[i - 1];
+		m_offsets[0] = 0;
+	}
+
+	void LightGrid::Clear()
+	{
+		m_sizeX = m_sizeZ = 0;
+		m_offsets.clear();
+		m_lightIndices.clear();
+		m_lightStamps.clear();
+	}
+
+	// Returns indices of lights which may reach sphere, in ascending order and without duplicates.
+	// Exact range test is left to caller.
+	void LightGrid::GetCandidates(const Vector3& position, float radius, std::vector<int>& lightIndices) const
+	{
+		lightIndices.clear();
+
+		if (m_lightIndices.empty())
+			return;
+
+		int minX = GetCellX(position.x - radius);
+		int maxX = GetCellX(position.x + radius);
+		int minZ = GetCellZ(position.z - radius);
+		int maxZ = GetCellZ(position.z + radius);
+
+		// Single cell lists are already sorted and unique.
+		if (minX == maxX && minZ == maxZ)
+		{
+			int cell = (minX * m_sizeZ) + minZ;
+			lightIndices.assign(m_lightIndices.begin() + m_offsets[cell], m_lightIndices.begin() + m_offsets[cell + 1]);
+			return;
+		}
+
+		// Lights spanning several cells are met more than once; stamp them to skip repeats.
+		m_stamp++;
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int z = minZ; z <= maxZ; z++)
+			{
+				int cell = (x * m_sizeZ) + z;
+				for (int i = m_offsets[cell]; i < m_offsets[cell + 1]; i++)
+				{
+					int lightIndex = m_lightIndices[i];
+					if (m_lightStamps[lightIndex] == m_stamp)
+						continue;
+
+					m_lightStamps[lightIndex] = m_stamp;
+					lightIndices.push_back(lightIndex);
+				}
+			}
+		}
+
+		std::sort(lightIndices.begin(), lightIndices.end());
+	}
+
+	int LightGrid::GetCellX(float x) const
+	{
+		return std::clamp((int)floor((x - m_originX) / m_cellSize), 0, m_sizeX - 1);
+	}
+
+	int LightGrid::GetCellZ(float z) const
+	{
+		return std::clamp((int)floor((z - m_originZ) / m_cellSize), 0, m_sizeZ - 1);
+	}
+
+	// Builds grid over random lights and queries it with random spheres, as renderer does with items and statics.
+	// Checks that grid finds same lights in range as linear scan, and logs time taken by both for several light counts.
+	bool BenchmarkLightGrid()
+	{
+		constexpr auto FRAME_COUNT = 100;
+		constexpr auto QUERY_COUNT = 1024;
+		constexpr auto VOLUME_SIZE = BLOCK(64);
+
+		constexpr auto LIGHT_COUNTS = std::array<int, 3>{ 32, 128, 512 };
+
+		auto isInRange = [](const RendererLight& light, const Vector3& pos, float radius)
+		{
+			return (Vector3::DistanceSquared(pos, light.Position) <= SQUARE(light.Out + radius));
+		};
+
+		bool isPassed = true;
+		for (int lightCount : LIGHT_COUNTS)
+		{
+			// Fixed seed keeps report reproducible between runs.
+			auto generator = std::mt19937(lightCount);
+			auto getRandom = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(generator); };
+
+			auto lights = std::vector<RendererLight>(lightCount);
+			for (auto& light : lights)
+			{
+				light.Position = Vector3(getRandom(0.0f, VOLUME_SIZE), getRandom(-BLOCK(4), 0.0f), getRandom(0.0f, VOLUME_SIZE));
+				light.Out = getRandom(BLOCK(1), BLOCK(8));
+			}
+
+			auto queries = std::vector<std::pair<Vector3, float>>(QUERY_COUNT);
+			for (auto& query : queries)
+				query = std::pair(Vector3(getRandom(0.0f, VOLUME_SIZE), getRandom(-BLOCK(4), 0.0f), getRandom(0.0f, VOLUME_SIZE)), getRandom(BLOCK(0.25f), BLOCK(2)));
+
+			auto grid = LightGrid();
+			auto candidates = std::vector<int>{};
+			int gridSum = 0;
+			int linearSum = 0;
+
+			auto startTime = std::chrono::high_resolution_clock::now();
+			for (int frame = 0; frame < FRAME_COUNT; frame++)
+			{
+				grid.Build(lights, Vector3(0.0f, -BLOCK(4), 0.0f), Vector3(VOLUME_SIZE, 0.0f, VOLUME_SIZE));
+
+				for (const auto& [pos, radius] : queries)
+				{
+					grid.GetCandidates(pos, radius, candidates);
+					for (int lightIndex : candidates)
+					{
+						if (isInRange(lights[lightIndex], pos, radius))
+							gridSum++;
+					}
+				}
+			}
+			auto gridTime = std::chrono::high_resolution_clock::now() - startTime;
+
+			startTime = std::chrono::high_resolution_clock::now();
+			for (int frame = 0; frame < FRAME_COUNT; frame++)
+			{
+				for (const auto& [pos, radius] : queries)
+				{
+					for (int i = 0; i < lights.size(); i++)
+					{
+						if (isInRange(lights[i], pos, radius))
+							linearSum++;
+					}
+				}
+			}
+			auto linearTime = std::chrono::high_resolution_clock::now() - startTime;
+
+			// Compare actual light lists once, outside timed loops.
+			int mismatchCount = 0;
+			auto gridResult = std::vector<int>{};
+			auto linearResult = std::vector<int>{};
+			for (const auto& [pos, radius] : queries)
+			{
+				grid.GetCandidates(pos, radius, candidates);
+
+				gridResult.clear();
+				for (int lightIndex : candidates)
+				{
+					if (isInRange(lights[lightIndex], pos, radius))
+						gridResult.push_back(lightIndex);
+				}
+
+				linearResult.clear();
+				for (int i = 0; i < lights.size(); i++)
+				{
+					if (isInRange(lights[i], pos, radius))
+						linearResult.push_back(i);
+				}
+
+				if (gridResult != linearResult)
+					mismatchCount++;
+			}
+
+			using us = std::chrono::duration<double, std::micro>;
+			TENLog("Light grid: " + std::to_string(lightCount) + " lights, " + std::to_string(QUERY_COUNT) + " queries, " + std::to_string(mismatchCount) +
+				   " mismatches. " + std::to_string(us(gridTime).count() / FRAME_COUNT) + " us per frame including build (linear scan " +
+				   std::to_string(us(linearTime).count() / FRAME_COUNT) + " us).", LogLevel::Info);
+
+			if (mismatchCount != 0 || gridSum != linearSum)
+				isPassed = false;
+		}
+
+		return isPassed;
+	}
+}
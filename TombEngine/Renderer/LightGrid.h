@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+#include "Renderer/Structures/RendererLight.h"
+
+namespace TEN::Renderer
+{
+	// Uniform XZ grid of lights, rebuilt every frame over visible room volume. Each light is registered
+	// in every cell its radius overlaps, so object only needs to test lights from cells it overlaps.
+	// Positions outside grid are clamped to border cells, so no light is ever missed.
+	class LightGrid
+	{
+	public:
+		LightGrid() = default;
+
+		void Build(const std::vector<RendererLight>& lights, const Vector3& boundsMin, const Vector3& boundsMax);
+		void Clear();
+		void GetCandidates(const Vector3& position, float radius, std::vector<int>& lightIndices) const;
+
+	private:
+		float m_originX	 = 0.0f;
+		float m_originZ	 = 0.0f;
+		float m_cellSize = 1.0f;
+		int	  m_sizeX	 = 0;
+		int	  m_sizeZ	 = 0;
+
+		std::vector<int> m_offsets		= {}; // Per cell offset into m_lightIndices, with one extra entry at end.
+		std::vector<int> m_lightIndices = {};
+
+		// Per light query stamp, so lights met in several cells are returned once without sorting duplicates.
+		mutable std::vector<unsigned int> m_lightStamps = {};
+		mutable unsigned int			  m_stamp		= 0;
+
+		int GetCellX(float x) const;
+		int GetCellZ(float z) const;
+	};
+
+	bool BenchmarkLightGrid();
+}
@@ -16,6 +16,7 @@
 #include "Game/effects/Electricity.h"
 #include "Specific/level.h"
 #include "Specific/fast_vector.h"
+#include "Specific/memory/RadixSort.h"
 #include "Renderer/Renderer11Enums.h"
 #include "Renderer/Structures/RendererLight.h"
 #include "RenderView/RenderView.h"
@@ -33,6 +34,9 @@
 #include "Renderer/ConstantBuffers/SpriteBuffer.h"
 #include "Renderer/ConstantBuffers/InstancedStaticBuffer.h"
 #include "Frustum.h"
+#include "Renderer/LightGrid.h"
+#include "Renderer/RoomVisibility.h"
+#include "Renderer/StringLayoutCache.h"
 #include "RendererBucket.h"
 #include "Renderer/RenderTargetCube/RenderTargetCube.h"
 #include "Specific/level.h"
@@ -50,7 +54,6 @@
 #include "Renderer/IndexBuffer/IndexBuffer.h"
 #include "Renderer/Texture2D/Texture2D.h"
 #include "Renderer/RenderTarget2D/RenderTarget2D.h"
-#include "Renderer/Structures/RendererDoor.h"
 #include "Renderer/ConstantBuffers/SkyBuffer.h"
 
 enum GAME_OBJECT_ID : short;
@@ -303,7 +306,8 @@ namespace TEN::Renderer
 
 		Texture2DArray m_shadowMap;
 
-		std::vector<short> m_visitedRoomsStack;
+		RoomVisibility m_roomVisibility;
+		std::vector<int> m_collectedRooms;
 
 		// Shaders
 		ComPtr<ID3D11VertexShader> m_vsRooms;
@@ -380,6 +384,7 @@ namespace TEN::Renderer
 		// Text
 		std::unique_ptr<SpriteFont> m_gameFont;
 		std::vector<RendererStringToDraw> m_strings;
+		StringLayoutCache m_stringLayouts;
 		float BlinkColorValue = 0.0f;
 		float BlinkTime		  = 0.0f;
 		bool  IsBlinkUpdated  = false;
@@ -387,6 +392,7 @@ namespace TEN::Renderer
 		// System resources
 		Texture2D m_logo;
 		Texture2D m_skyTexture;
+		Texture2D m_defaultNormalTexture;
 		Texture2D m_whiteTexture;
 		RendererSprite m_whiteSprite;
 		Texture2D m_loadingBarBorder;
@@ -413,6 +419,16 @@ namespace TEN::Renderer
 		fast_vector<int> m_transparentFacesIndices;
 		std::vector<RendererTransparentFace> m_transparentFaces;
 
+		// Per-frame scratch lists. They are cleared, not freed, so capacity is reused across frames.
+		std::vector<TEN::Memory::SortKey> m_sortKeys;
+		std::vector<TEN::Memory::SortKey> m_sortKeysScratch;
+		std::vector<RendererTransparentFace> m_sortedFaces;
+		std::vector<RendererSpriteToDraw> m_sortedSprites;
+		std::vector<RendererSpriteBucket> m_spriteBuckets;
+		std::vector<RendererSpriteToDraw*> m_spriteBucketSprites;
+		std::vector<RendererFogBulb> m_fogBulbs;
+		std::vector<RendererLight*> m_tempLights;
+
 		VertexBuffer m_skyVertexBuffer;
 		IndexBuffer m_skyIndexBuffer;
 
@@ -420,6 +436,11 @@ namespace TEN::Renderer
 		bool m_invalidateCache;
 
 		std::vector<RendererLight> m_dynamicLights;
+		LightGrid m_dynamicLightGrid;
+		Vector3 m_dynamicLightGridMin;
+		Vector3 m_dynamicLightGridMax;
+		bool m_dynamicLightGridDirty = true;
+		std::vector<int> m_dynamicLightCandidates;
 		RendererLight* m_shadowLight;
 
 		std::vector<RendererLine3D> m_lines3DToDraw;
@@ -441,9 +462,9 @@ namespace TEN::Renderer
 		std::vector<Texture2D> m_spritesTextures;
 
 		// Preallocated pools of objects for avoiding new/delete
-		// Items and effects are safe (can't be more than 1024 items in TR), 
+		// Items are allocated on demand as item pool grows (deque keeps existing pointers valid),
 		// lights should be oversized (eventually ignore lights more than MAX_LIGHTS)
-		RendererItem m_items[NUM_ITEMS];
+		std::deque<RendererItem> m_items;
 		RendererEffect m_effects[NUM_ITEMS];
 
 		// Debug variables
@@ -504,8 +525,6 @@ namespace TEN::Renderer
 		void BuildHierarchy(RendererObject* obj);
 		void BuildHierarchyRecursive(RendererObject* obj, RendererBone* node, RendererBone* parentNode);
 		void UpdateAnimation(RendererItem* item, RendererObject& obj, const AnimFrameInterpData& frameData, int mask, bool useObjectWorldRotation = false);
-		bool CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView);
-		void GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView);
 		void CollectRooms(RenderView& renderView, bool onlyRooms);
 		void CollectItems(short roomNumber, RenderView& renderView);
 		void CollectStatics(short roomNumber, RenderView& renderView);
@@ -529,6 +548,7 @@ namespace TEN::Renderer
 		void InitializeSky();
 
 		void DrawAllStrings();
+		const RendererStringLayout& GetStringLayout(const std::string& string);
 		void DrawLaserBarriers(RenderView& view);
 		void DrawHorizonAndSky(RenderView& renderView, ID3D11DepthStencilView* depthTarget);
 		void DrawRooms(RenderView& view, RendererPass rendererPass);
@@ -556,6 +576,8 @@ namespace TEN::Renderer
 		void DrawSplashes(RenderView& view);
 		void DrawSprites(RenderView& view);
 		void DrawSortedFaces(RenderView& view);
+		void SortSprites(std::vector<RendererSpriteToDraw>& sprites);
+		void SortTransparentFaces(std::vector<RendererTransparentFace>& faces);
 		void DrawLines3D(RenderView& view);
 		void DrawLines2D();
 		void DrawOverlays(RenderView& view);
@@ -635,6 +657,7 @@ namespace TEN::Renderer
 		Matrix GetWorldMatrixForSprite(RendererSpriteToDraw* spr, RenderView& view);
 
 		RendererObject& GetRendererObject(GAME_OBJECT_ID id);
+		RendererItem* GetRendererItem(int itemNumber);
 		RendererMesh* GetMesh(int meshIndex);
 		Texture2D CreateDefaultNormalTexture();
 
@@ -31,65 +31,41 @@ namespace TEN::Renderer
 
 		TENLog("Allocated renderer object memory.", LogLevel::Info);
 
-		m_animatedTextures.resize(g_Level.AnimatedTextures.size());
-		for (int i = 0; i < g_Level.AnimatedTextures.size(); i++)
-		{
-			TEXTURE* texture = &g_Level.AnimatedTextures[i];
-			Texture2D normal;
-			if (texture->normalMapData.size() < 1)
-			{
-				normal = CreateDefaultNormalTexture();
-			}
-			else
-			{
-				normal = Texture2D(m_device.Get(), texture->normalMapData.data(), (int)texture->normalMapData.size());
-			}
+		// All textures without normal map share single default one.
+		m_defaultNormalTexture = CreateDefaultNormalTexture();
 
-			TexturePair tex = std::make_tuple(Texture2D(m_device.Get(), texture->colorMapData.data(), (int)texture->colorMapData.size()), normal);
-			m_animatedTextures[i] = tex;
-		}
+		// Decode and mip level textures on worker threads ahead of device, so that device only has to upload results.
+		// Each source is listed with texture it is created into, since textures are created in order they finish decoding.
+		auto textureSources = std::vector<TextureSource>{};
+		auto textureData = std::vector<std::vector<byte>*>{};
+		auto textureTargets = std::vector<Texture2D*>{};
 
-		if (m_animatedTextures.size() > 0)
-			TENLog("Generated " + std::to_string(m_animatedTextures.size()) + " animated textures.", LogLevel::Info);
+		auto addTexture = [&](std::vector<byte>& data, Texture2D& target)
+		{
+			textureSources.push_back(TextureSource{ data.data(), (int)data.size() });
+			textureData.push_back(&data);
+			textureTargets.push_back(&target);
+		};
 
-		std::transform(g_Level.AnimatedTexturesSequences.begin(), g_Level.AnimatedTexturesSequences.end(), std::back_inserter(m_animatedTextureSets), [](ANIMATED_TEXTURES_SEQUENCE& sequence) {
-			RendererAnimatedTextureSet set{};
-			set.NumTextures = sequence.numFrames;
-			std::transform(sequence.frames.begin(), sequence.frames.end(), std::back_inserter(set.Textures), [](ANIMATED_TEXTURES_FRAME& frm) {
-				RendererAnimatedTexture tex{};
-				tex.UV[0].x = frm.x1;
-				tex.UV[0].y = frm.y1;
-				tex.UV[1].x = frm.x2;
-				tex.UV[1].y = frm.y2;
-				tex.UV[2].x = frm.x3;
-				tex.UV[2].y = frm.y3;
-				tex.UV[3].x = frm.x4;
-				tex.UV[3].y = frm.y4;
-				return tex;
-			});
-			set.Fps = sequence.Fps;
-			return set;
-		});
+		auto addTexturePair = [&](TEXTURE& texture, TexturePair& target)
+		{
+			addTexture(texture.colorMapData, std::get<0>(target));
 
-		if (m_animatedTextureSets.size() > 0)
-			TENLog("Generated " + std::to_string(m_animatedTextureSets.size()) + " animated texture sets.", LogLevel::Info);
+			if (texture.normalMapData.empty())
+				std::get<1>(target) = m_defaultNormalTexture;
+			else
+				addTexture(texture.normalMapData, std::get<1>(target));
+		};
+
+		m_animatedTextures.resize(g_Level.AnimatedTextures.size());
+		for (int i = 0; i < g_Level.AnimatedTextures.size(); i++)
+			addTexturePair(g_Level.AnimatedTextures[i], m_animatedTextures[i]);
 
 		m_roomTextures.resize(g_Level.RoomTextures.size());
 		for (int i = 0; i < g_Level.RoomTextures.size(); i++)
 		{
-			TEXTURE *texture = &g_Level.RoomTextures[i];
-			Texture2D normal;
-			if (texture->normalMapData.size() < 1)
-			{
-				normal = CreateDefaultNormalTexture();
-			}
-			else
-			{
-				normal = Texture2D(m_device.Get(), texture->normalMapData.data(), (int)texture->normalMapData.size());
-			}
-
-			TexturePair tex = std::make_tuple(Texture2D(m_device.Get(), texture->colorMapData.data(), (int)texture->colorMapData.size()), normal);
-			m_roomTextures[i] = tex;
+			TEXTURE* texture = &g_Level.RoomTextures[i];
+			addTexturePair(*texture, m_roomTextures[i]);
 
 #ifdef DUMP_TEXTURES
 			char filename[255];
@@ -100,25 +76,11 @@ namespace TEN::Renderer
 #endif
 		}
 
-		if (m_roomTextures.size() > 0)
-			TENLog("Generated " + std::to_string(m_roomTextures.size()) + " room texture atlases.", LogLevel::Info);
-
 		m_moveablesTextures.resize(g_Level.MoveablesTextures.size());
 		for (int i = 0; i < g_Level.MoveablesTextures.size(); i++)
 		{
-			TEXTURE *texture = &g_Level.MoveablesTextures[i];
-			Texture2D normal;
-			if (texture->normalMapData.size() < 1)
-			{
-				normal = CreateDefaultNormalTexture();
-			}
-			else
-			{
-				normal = Texture2D(m_device.Get(), texture->normalMapData.data(), (int)texture->normalMapData.size());
-			}
-
-			TexturePair tex = std::make_tuple(Texture2D(m_device.Get(), texture->colorMapData.data(), (int)texture->colorMapData.size()), normal);
-			m_moveablesTextures[i] = tex;
+			TEXTURE* texture = &g_Level.MoveablesTextures[i];
+			addTexturePair(*texture, m_moveablesTextures[i]);
 
 #ifdef DUMP_TEXTURES
 			char filename[255];
@@ -129,25 +91,11 @@ namespace TEN::Renderer
 #endif
 		}
 
-		if (m_moveablesTextures.size() > 0)
-			TENLog("Generated " + std::to_string(m_moveablesTextures.size()) + " moveable texture atlases.", LogLevel::Info);
-
 		m_staticsTextures.resize(g_Level.StaticsTextures.size());
 		for (int i = 0; i < g_Level.StaticsTextures.size(); i++)
 		{
-			TEXTURE *texture = &g_Level.StaticsTextures[i];
-			Texture2D normal;
-			if (texture->normalMapData.size() < 1)
-			{
-				normal = CreateDefaultNormalTexture();
-			}
-			else
-			{
-				normal = Texture2D(m_device.Get(), texture->normalMapData.data(), (int)texture->normalMapData.size());
-			}
-
-			TexturePair tex = std::make_tuple(Texture2D(m_device.Get(), texture->colorMapData.data(), (int)texture->colorMapData.size()), normal);
-			m_staticsTextures[i] = tex;
+			TEXTURE* texture = &g_Level.StaticsTextures[i];
+			addTexturePair(*texture, m_staticsTextures[i]);
 
 #ifdef DUMP_TEXTURES
 			char filename[255];
@@ -158,21 +106,66 @@ namespace TEN::Renderer
 #endif
 		}
 
-		if (m_staticsTextures.size() > 0)
-			TENLog("Generated " + std::to_string(m_staticsTextures.size()) + " static mesh texture atlases.", LogLevel::Info);
-
 		m_spritesTextures.resize(g_Level.SpritesTextures.size());
 		for (int i = 0; i < g_Level.SpritesTextures.size(); i++)
+			addTexture(g_Level.SpritesTextures[i].colorMapData, m_spritesTextures[i]);
+
+		addTexture(g_Level.SkyTexture.colorMapData, m_skyTexture);
+
+		// DDS textures and textures which failed to decode are created by device directly.
 		{
-			TEXTURE *texture = &g_Level.SpritesTextures[i];
-			m_spritesTextures[i] = Texture2D(m_device.Get(), texture->colorMapData.data(), (int)texture->colorMapData.size());
+			auto textureQueue = TextureDecodeQueue(textureSources, TEXTURE_DECODE_QUEUE_SIZE);
+
+			int index = 0;
+			auto decodedTexture = TextureData{};
+			while (textureQueue.TakeNext(index, decodedTexture))
+			{
+				if (decodedTexture.IsValid())
+					*textureTargets[index] = Texture2D(m_device.Get(), decodedTexture);
+				else
+					*textureTargets[index] = Texture2D(m_device.Get(), textureData[index]->data(), (int)textureData[index]->size());
+			}
+
+			textureQueue.Finish();
 		}
 
+		if (m_animatedTextures.size() > 0)
+			TENLog("Generated " + std::to_string(m_animatedTextures.size()) + " animated textures.", LogLevel::Info);
+
+		std::transform(g_Level.AnimatedTexturesSequences.begin(), g_Level.AnimatedTexturesSequences.end(), std::back_inserter(m_animatedTextureSets), [](ANIMATED_TEXTURES_SEQUENCE& sequence) {
+			RendererAnimatedTextureSet set{};
+			set.NumTextures = sequence.numFrames;
+			std::transform(sequence.frames.begin(), sequence.frames.end(), std::back_inserter(set.Textures), [](ANIMATED_TEXTURES_FRAME& frm) {
+				RendererAnimatedTexture tex{};
+				tex.UV[0].x = frm.x1;
+				tex.UV[0].y = frm.y1;
+				tex.UV[1].x = frm.x2;
+				tex.UV[1].y = frm.y2;
+				tex.UV[2].x = frm.x3;
+				tex.UV[2].y = frm.y3;
+				tex.UV[3].x = frm.x4;
+				tex.UV[3].y = frm.y4;
+				return tex;
+			});
+			set.Fps = sequence.Fps;
+			return set;
+		});
+
+		if (m_animatedTextureSets.size() > 0)
+			TENLog("Generated " + std::to_string(m_animatedTextureSets.size()) + " animated texture sets.", LogLevel::Info);
+
+		if (m_roomTextures.size() > 0)
+			TENLog("Generated " + std::to_string(m_roomTextures.size()) + " room texture atlases.", LogLevel::Info);
+
+		if (m_moveablesTextures.size() > 0)
+			TENLog("Generated " + std::to_string(m_moveablesTextures.size()) + " moveable texture atlases.", LogLevel::Info);
+
+		if (m_staticsTextures.size() > 0)
+			TENLog("Generated " + std::to_string(m_staticsTextures.size()) + " static mesh texture atlases.", LogLevel::Info);
+
 		if (m_spritesTextures.size() > 0)
 			TENLog("Generated " + std::to_string((int)m_spritesTextures.size()) + " sprite atlases.", LogLevel::Info);
 
-		m_skyTexture = Texture2D(m_device.Get(), g_Level.SkyTexture.colorMapData.data(), (int)g_Level.SkyTexture.colorMapData.size());
-
 		TENLog("Loaded sky texture.", LogLevel::Info);
 
 		int totalVertices = 0;
@@ -220,29 +213,6 @@ namespace TEN::Renderer
 				if (g_Level.Rooms[j].Active())
 					r->Neighbors.push_back(j);
 
-			if (room.doors.size() != 0)
-			{
-				r->Doors.resize((int)room.doors.size());
-
-				for (int l = 0; l < room.doors.size(); l++)
-				{
-					RendererDoor* door = &r->Doors[l];
-					ROOM_DOOR* oldDoor = &room.doors[l];
-
-					door->RoomNumber = oldDoor->room;
-					door->Normal = oldDoor->normal;
-
-					for (int k = 0; k < 4; k++)
-					{
-						door->AbsoluteVertices[k] = Vector4(
-							room.x + oldDoor->vertices[k].x,
-							room.y + oldDoor->vertices[k].y,
-							room.z + oldDoor->vertices[k].z,
-							1.0f);
-					}
-				}
-			}
-
 			if (room.mesh.size() != 0)
 			{
 				r->Statics.resize(room.mesh.size());
@@ -269,7 +239,8 @@ namespace TEN::Renderer
 
 			if (room.positions.empty())
 				continue;
-			
+
+			const auto& arena = g_Level.Polygons;
 			for (auto& levelBucket : room.buckets)
 			{
 				RendererBucket bucket{};
@@ -284,18 +255,19 @@ namespace TEN::Renderer
 
 				for (auto& poly : levelBucket.polygons)
 				{
+					const int* polyIndices = &arena.Indices[poly.baseIndex];
 					RendererPolygon newPoly;
 
 					newPoly.shape = poly.shape;
 
 					newPoly.centre = (
-						room.positions[poly.indices[0]] +
-						room.positions[poly.indices[1]] +
-						room.positions[poly.indices[2]]) / 3.0f;
+						room.positions[polyIndices[0]] +
+						room.positions[polyIndices[1]] +
+						room.positions[polyIndices[2]]) / 3.0f;
 
-					Vector3 p1 = room.positions[poly.indices[0]];
-					Vector3 p2 = room.positions[poly.indices[1]];
-					Vector3 p3 = room.positions[poly.indices[2]];
+					Vector3 p1 = room.positions[polyIndices[0]];
+					Vector3 p2 = room.positions[polyIndices[1]];
+					Vector3 p3 = room.positions[polyIndices[2]];
 
 					Vector3 n = (p2 - p1).Cross(p3 - p1);
 					n.Normalize();
@@ -303,20 +275,20 @@ namespace TEN::Renderer
 					newPoly.Normal = n;
 					
 					int baseVertices = lastVertex;
-					for (int k = 0; k < poly.indices.size(); k++)
+					for (int k = 0; k < poly.vertexCount; k++)
 					{
 						RendererVertex* vertex = &m_roomsVertices[lastVertex];
-						int index = poly.indices[k];
+						int index = polyIndices[k];
 
 						vertex->Position.x = room.x + room.positions[index].x;
 						vertex->Position.y = room.y + room.positions[index].y;
 						vertex->Position.z = room.z + room.positions[index].z;
 
-						vertex->Normal = poly.normals[k];
-						vertex->UV = poly.textureCoordinates[k];
+						vertex->Normal = arena.Normals[poly.baseIndex + k];
+						vertex->UV = arena.TextureCoordinates[poly.baseIndex + k];
 						vertex->Color = Vector4(room.colors[index].x, room.colors[index].y, room.colors[index].z, 1.0f);
-						vertex->Tangent = poly.tangents[k];
-						vertex->Binormal = poly.binormals[k];
+						vertex->Tangent = arena.Tangents[poly.baseIndex + k];
+						vertex->Binormal = arena.Binormals[poly.baseIndex + k];
 						vertex->AnimationFrameOffset = poly.animatedFrame;
 						vertex->IndexInPoly = k;
 						vertex->OriginalIndex = index;
@@ -459,6 +431,9 @@ namespace TEN::Renderer
 			}
 		);
 
+		m_roomVisibility.Initialize(g_Level.Rooms);
+		m_collectedRooms.clear();
+
 		TENLog("Preparing object data...", LogLevel::Info);
 			 
 		bool isSkinPresent = false;
@@ -844,6 +819,7 @@ namespace TEN::Renderer
 			m_sprites[i] = RendererSprite();
 			RendererSprite &sprite = m_sprites[i];
 
+			sprite.Index = i;
 			sprite.UV[0] = Vector2(oldSprite->x1, oldSprite->y1);
 			sprite.UV[1] = Vector2(oldSprite->x2, oldSprite->y2);
 			sprite.UV[2] = Vector2(oldSprite->x3, oldSprite->y3);
@@ -853,6 +829,9 @@ namespace TEN::Renderer
 			sprite.Height = (oldSprite->y3 - oldSprite->y2) * sprite.Texture->Height + 1;
 		}
 
+		// Sprite index is used as sort key, so white sprite gets index past level sprites.
+		m_whiteSprite.Index = (int)m_sprites.size();
+
 		for (int i = 0; i < MoveablesIds.size(); i++)
 		{
 			ObjectInfo *obj = &Objects[MoveablesIds[i]];
@@ -890,6 +869,7 @@ namespace TEN::Renderer
 		for (int i = 0; i < meshPtr->positions.size(); i++)
 			mesh->Positions[i] = meshPtr->positions[i];
 
+		const auto& arena = g_Level.Polygons;
 		for (int n = 0; n < meshPtr->buckets.size(); n++)
 		{
 			BUCKET* levelBucket = &meshPtr->buckets[n];
@@ -905,39 +885,33 @@ namespace TEN::Renderer
 			for (int p = 0; p < (int)levelBucket->polygons.size(); p++)
 			{
 				POLYGON* poly = &levelBucket->polygons[p];
+				const int* polyIndices = &arena.Indices[poly->baseIndex];
 				RendererPolygon newPoly;
 
 				newPoly.shape = poly->shape;
 				newPoly.centre = (
-					meshPtr->positions[poly->indices[0]] +
-					meshPtr->positions[poly->indices[1]] +
-					meshPtr->positions[poly->indices[2]]) / 3.0f;
+					meshPtr->positions[polyIndices[0]] +
+					meshPtr->positions[polyIndices[1]] +
+					meshPtr->positions[polyIndices[2]]) / 3.0f;
 
 				int baseVertices = *lastVertex;
 
-				for (int k = 0; k < (int)poly->indices.size(); k++)
+				for (int k = 0; k < poly->vertexCount; k++)
 				{
 					RendererVertex vertex;
-					int v = poly->indices[k];
+					int v = polyIndices[k];
 
 					vertex.Position.x = meshPtr->positions[v].x;
 					vertex.Position.y = meshPtr->positions[v].y;
 					vertex.Position.z = meshPtr->positions[v].z;
 					 
-					vertex.Normal.x = poly->normals[k].x;
-					vertex.Normal.y = poly->normals[k].y;
-					vertex.Normal.z = poly->normals[k].z;
+					vertex.Normal = arena.Normals[poly->baseIndex + k];
 
-					vertex.Tangent.x = poly->tangents[k].x;
-					vertex.Tangent.y = poly->tangents[k].y;
-					vertex.Tangent.z = poly->tangents[k].z;
+					vertex.Tangent = arena.Tangents[poly->baseIndex + k];
 
-					vertex.Binormal.x = poly->binormals[k].x;
-					vertex.Binormal.y = poly->binormals[k].y;
-					vertex.Binormal.z = poly->binormals[k].z;
+					vertex.Binormal = arena.Binormals[poly->baseIndex + k];
 
-					vertex.UV.x = poly->textureCoordinates[k].x;
-					vertex.UV.y = poly->textureCoordinates[k].y;
+					vertex.UV = arena.TextureCoordinates[poly->baseIndex + k];
 
 					vertex.Color.x = meshPtr->colors[v].x;
 					vertex.Color.y = meshPtr->colors[v].y;
@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <chrono>
-#include <execution>
 #include <filesystem>
 
 #include "ConstantBuffers/CameraMatrixBuffer.h"
@@ -248,7 +247,7 @@ namespace TEN::Renderer
 	void Renderer11::DrawGunShells(RenderView& view)
 	{
 		auto& room = m_rooms[LaraItem->RoomNumber];
-		auto* item = &m_items[LaraItem->Index];
+		auto* item = GetRendererItem(LaraItem->Index);
 
 		int gunShellsCount = 0;
 		short objectNumber = 0;
@@ -982,11 +981,13 @@ namespace TEN::Renderer
 		dynamicLight.Luma = Luma(dynamicLight.Color);
 
 		m_dynamicLights.push_back(dynamicLight);
+		m_dynamicLightGridDirty = true;
 	}
 
 	void Renderer11::ClearDynamicLights()
 	{
 		m_dynamicLights.clear();
+		m_dynamicLightGridDirty = true;
 	}
 
 	void Renderer11::ClearScene()
@@ -1006,23 +1007,43 @@ namespace TEN::Renderer
 		CalculateFrameRate();
 	}
 
+	void Renderer11::SortTransparentFaces(std::vector<RendererTransparentFace>& faces)
+	{
+		if (faces.size() < 2)
+			return;
+
+		m_sortKeys.resize(faces.size());
+		for (int i = 0; i < faces.size(); i++)
+		{
+			const auto& face = faces[i];
+
+			// Sprites don't have texture set, so sprite index is used to group them instead.
+			int texture = (face.type == RendererTransparentFaceType::TRANSPARENT_FACE_SPRITE) ?
+				face.info.sprite->Sprite->Index : face.info.texture;
+
+			// Farthest faces go first. Faces at same distance are grouped by state to help batching.
+			uint64_t key =
+				((uint64_t)~(uint32_t)std::max(face.distance, 0) << 32) |
+				((uint64_t)((int)face.type & 0xFF) << 24) |
+				((uint64_t)(face.info.blendMode & 0xFF) << 16) |
+				(uint64_t)(texture & 0xFFFF);
+
+			m_sortKeys[i] = TEN::Memory::SortKey{ key, i };
+		}
+
+		TEN::Memory::RadixSort(m_sortKeys, m_sortKeysScratch);
+
+		m_sortedFaces.clear();
+		for (const auto& sortKey : m_sortKeys)
+			m_sortedFaces.push_back(faces[sortKey.Index]);
+
+		faces.swap(m_sortedFaces);
+	}
+
 	void Renderer11::DrawSortedFaces(RenderView& view)
 	{
-		std::for_each(std::execution::par_unseq,
-					  view.RoomsToDraw.begin(),
-					  view.RoomsToDraw.end(),
-					  [](RendererRoom* room)
-					  {
-						  std::sort(
-							  room->TransparentFacesToDraw.begin(),
-							  room->TransparentFacesToDraw.end(),
-							  [](RendererTransparentFace& a, RendererTransparentFace& b)
-							  {
-								  return (a.distance > b.distance);
-							  }
-						  );
-					  }
-		);
+		for (auto* room : view.RoomsToDraw)
+			SortTransparentFaces(room->TransparentFacesToDraw);
 
 		for (int r = (int)view.RoomsToDraw.size() - 1; r >= 0; r--)
 		{
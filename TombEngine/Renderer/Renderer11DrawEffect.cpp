@@ -56,18 +56,6 @@ namespace TEN::Renderer
 {
 	constexpr auto ELECTRICITY_RANGE_MAX = BLOCK(24);
 
-	struct RendererSpriteBucket
-	{
-		RendererSprite* Sprite;
-		BLEND_MODES BlendMode;
-		std::vector<RendererSpriteToDraw> SpritesToDraw;
-
-		bool IsBillboard	= false;
-		bool IsSoftParticle = false;
-
-		SpriteRenderType RenderType;
-	};
-	
 	void Renderer11::DrawLaserBarriers(RenderView& view)
 	{
 		if (LaserBarriers.empty())
@@ -849,7 +837,7 @@ namespace TEN::Renderer
 			return true;
 
 		const auto& room = m_rooms[LaraItem->RoomNumber];
-		auto* itemPtr = &m_items[LaraItem->Index];
+		auto* itemPtr = GetRendererItem(LaraItem->Index);
 
 		m_stStatic.Color = Vector4::One;
 		m_stStatic.AmbientLight = room.AmbientLight;
@@ -1134,34 +1122,54 @@ namespace TEN::Renderer
 		return spriteMatrix;
 	}
 
+	void Renderer11::SortSprites(std::vector<RendererSpriteToDraw>& sprites)
+	{
+		if (sprites.size() < 2)
+			return;
+
+		m_sortKeys.resize(sprites.size());
+		for (int i = 0; i < sprites.size(); i++)
+		{
+			const auto& sprite = sprites[i];
+
+			// Each sprite must have its own index, otherwise different sprites would be batched together.
+			assertion(sprite.Sprite == &m_whiteSprite ||
+					  (sprite.Sprite->Index >= 0 && sprite.Sprite->Index < m_sprites.size() && sprite.Sprite == &m_sprites[sprite.Sprite->Index]),
+					  "Sprite index doesn't match its sprite.");
+
+			uint64_t key =
+				((uint64_t)(uint32_t)sprite.Sprite->Index << 32) |
+				((uint64_t)(sprite.BlendMode & 0xFF) << 24) |
+				((uint64_t)((int)sprite.Type & 0xFF) << 16) |
+				((uint64_t)((int)sprite.renderType & 0xFF) << 8) |
+				(uint64_t)sprite.SoftParticle;
+
+			// Inverted, so sprites keep same descending order as before.
+			m_sortKeys[i] = TEN::Memory::SortKey{ ~key, i };
+		}
+
+		TEN::Memory::RadixSort(m_sortKeys, m_sortKeysScratch);
+
+		m_sortedSprites.clear();
+		for (const auto& sortKey : m_sortKeys)
+			m_sortedSprites.push_back(sprites[sortKey.Index]);
+
+		sprites.swap(m_sortedSprites);
+	}
+
 	void Renderer11::DrawSprites(RenderView& view)
 	{
 		if (view.SpritesToDraw.empty())
 			return;
 
 		// Sort sprites by sprite and blend mode for faster batching.
-		std::sort(
-			view.SpritesToDraw.begin(),
-			view.SpritesToDraw.end(),
-			[](RendererSpriteToDraw& rDrawSprite0, RendererSpriteToDraw& rDrawSprite1)
-			{
-				if (rDrawSprite0.Sprite != rDrawSprite1.Sprite)
-				{
-					return (rDrawSprite0.Sprite > rDrawSprite1.Sprite);
-				}
-				else if (rDrawSprite0.BlendMode != rDrawSprite1.BlendMode)
-				{
-					return (rDrawSprite0.BlendMode > rDrawSprite1.BlendMode);
-				}
-				else
-				{
-					return (rDrawSprite0.Type > rDrawSprite1.Type);
-				}
-			}
-		);
+		SortSprites(view.SpritesToDraw);
 
 		// Group sprites to draw in buckets for instancing (billboards only).
-		std::vector<RendererSpriteBucket> spriteBuckets;
+		// Buckets only reference sprites, so nothing is copied while grouping.
+		m_spriteBuckets.clear();
+		m_spriteBucketSprites.clear();
+
 		RendererSpriteBucket currentSpriteBucket;
 
 		currentSpriteBucket.Sprite = view.SpritesToDraw[0].Sprite;
@@ -1178,17 +1186,18 @@ namespace TEN::Renderer
 				rDrawSprite.BlendMode != currentSpriteBucket.BlendMode ||
 				rDrawSprite.SoftParticle != currentSpriteBucket.IsSoftParticle ||
 				rDrawSprite.renderType != currentSpriteBucket.RenderType ||
-				currentSpriteBucket.SpritesToDraw.size() == INSTANCED_SPRITES_BUCKET_SIZE || 
+				currentSpriteBucket.SpriteCount == INSTANCED_SPRITES_BUCKET_SIZE || 
 				isBillboard != currentSpriteBucket.IsBillboard)
 			{
-				spriteBuckets.push_back(currentSpriteBucket);
+				m_spriteBuckets.push_back(currentSpriteBucket);
 
 				currentSpriteBucket.Sprite = rDrawSprite.Sprite;
 				currentSpriteBucket.BlendMode = rDrawSprite.BlendMode;
 				currentSpriteBucket.IsBillboard = isBillboard;
 				currentSpriteBucket.IsSoftParticle = rDrawSprite.SoftParticle;
 				currentSpriteBucket.RenderType = rDrawSprite.renderType;
-				currentSpriteBucket.SpritesToDraw.clear();
+				currentSpriteBucket.FirstSprite = (int)m_spriteBucketSprites.size();
+				currentSpriteBucket.SpriteCount = 0;
 			}
 				 
 			//HACK: prevent sprites like Explosionsmoke which have blendmode_subtractive from having laser effects
@@ -1216,11 +1225,12 @@ namespace TEN::Renderer
 			// Add sprite to current bucket.
 			else
 			{
-				currentSpriteBucket.SpritesToDraw.push_back(rDrawSprite);
+				m_spriteBucketSprites.push_back(&rDrawSprite);
+				currentSpriteBucket.SpriteCount++;
 			}
 		}
 		     
-		spriteBuckets.push_back(currentSpriteBucket);
+		m_spriteBuckets.push_back(currentSpriteBucket);
 
 		BindRenderTargetAsTexture(TEXTURE_DEPTH_MAP, &m_depthMap, SAMPLER_LINEAR_CLAMP);
 
@@ -1237,15 +1247,15 @@ namespace TEN::Renderer
 		m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 		m_context->IASetVertexBuffers(0, 1, quadVertexBuffer.GetAddressOf(), &stride, &offset);
 
-		for (auto& spriteBucket : spriteBuckets)
+		for (auto& spriteBucket : m_spriteBuckets)
 		{
-			if (spriteBucket.SpritesToDraw.size() == 0 || !spriteBucket.IsBillboard)
+			if (spriteBucket.SpriteCount == 0 || !spriteBucket.IsBillboard)
 				continue;
 
 			// Prepare constant buffer for instanced sprites.
-			for (int i = 0; i < spriteBucket.SpritesToDraw.size(); i++)
+			for (int i = 0; i < spriteBucket.SpriteCount; i++)
 			{
-				auto& rDrawSprite = spriteBucket.SpritesToDraw[i];
+				auto& rDrawSprite = *m_spriteBucketSprites[spriteBucket.FirstSprite + i];
 
 				m_stInstancedSpriteBuffer.Sprites[i].World = GetWorldMatrixForSprite(&rDrawSprite, view);
 				m_stInstancedSpriteBuffer.Sprites[i].Color = rDrawSprite.color;
@@ -1280,7 +1290,7 @@ namespace TEN::Renderer
 			BindConstantBufferPS(CB_INSTANCED_SPRITES, m_cbInstancedSpriteBuffer.get());
 
 			// Draw sprites with instancing.
-			DrawInstancedTriangles(4, (unsigned int)spriteBucket.SpritesToDraw.size(), 0);
+			DrawInstancedTriangles(4, (unsigned int)spriteBucket.SpriteCount, 0);
 
 			m_numSpritesDrawCalls++;
 		}
@@ -1298,9 +1308,9 @@ namespace TEN::Renderer
 		m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 		m_context->IASetVertexBuffers(0, 1, quadVertexBuffer.GetAddressOf(), &stride, &offset);
 
-		for (auto& spriteBucket : spriteBuckets)
+		for (auto& spriteBucket : m_spriteBuckets)
 		{
-			if (spriteBucket.SpritesToDraw.empty() || spriteBucket.IsBillboard)
+			if (spriteBucket.SpriteCount == 0 || spriteBucket.IsBillboard)
 				continue;
 
 			m_stSprite.IsSoftParticle = spriteBucket.IsSoftParticle ? 1 : 0;
@@ -1324,8 +1334,10 @@ namespace TEN::Renderer
 
 			m_primitiveBatch->Begin();
 
-			for (auto& rDrawSprite : spriteBucket.SpritesToDraw)
+			for (int i = 0; i < spriteBucket.SpriteCount; i++)
 			{
+				auto& rDrawSprite = *m_spriteBucketSprites[spriteBucket.FirstSprite + i];
+
 				auto vertex0 = RendererVertex{};
 				vertex0.Position = rDrawSprite.vtx1;
 				vertex0.UV = rDrawSprite.Sprite->UV[0];
@@ -1476,79 +1488,78 @@ namespace TEN::Renderer
 		BindConstantBufferVS(CB_STATIC, m_cbStatic.get());
 		BindConstantBufferPS(CB_STATIC, m_cbStatic.get());
 
-		extern std::vector<DebrisFragment> DebrisFragments;
 		std::vector<RendererVertex> vertices;
 
 		BLEND_MODES lastBlendMode = BLEND_MODES::BLENDMODE_UNSET;
 
-		for (auto deb = DebrisFragments.begin(); deb != DebrisFragments.end(); deb++)
+		for (int i = 0; i < Debris.Count; i++)
 		{
-			if (deb->active) 
-			{
-				if (!((deb->mesh.blendMode == BLENDMODE_OPAQUE || deb->mesh.blendMode == BLENDMODE_ALPHATEST) ^ (rendererPass == RendererPass::Transparent)))
-					continue;
+			const auto& mesh = Debris.Meshes[i];
 
-				Matrix translation = Matrix::CreateTranslation(deb->worldPosition.x, deb->worldPosition.y, deb->worldPosition.z);
-				Matrix rotation = Matrix::CreateFromQuaternion(deb->rotation);
-				Matrix world = rotation * translation;
+			if (!((mesh.blendMode == BLENDMODE_OPAQUE || mesh.blendMode == BLENDMODE_ALPHATEST) ^ (rendererPass == RendererPass::Transparent)))
+				continue;
 
-				m_primitiveBatch->Begin();
+			const auto& pos = Debris.Positions[i];
+			Matrix translation = Matrix::CreateTranslation(pos.x, pos.y, pos.z);
+			Matrix rotation = Matrix::CreateFromQuaternion(Debris.Orientations[i]);
+			Matrix world = rotation * translation;
 
-				if (deb->isStatic) 
-				{
-					BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_staticsTextures[deb->mesh.tex]), SAMPLER_LINEAR_CLAMP);
-				} 
-				else 
-				{
-					BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_moveablesTextures[deb->mesh.tex]), SAMPLER_LINEAR_CLAMP);
-				}
+			m_primitiveBatch->Begin();
 
-				if (rendererPass == RendererPass::Transparent)
-				{
-					SetAlphaTest(ALPHA_TEST_NONE, 1.0f);
-				}
-				else
-				{
-					SetAlphaTest(ALPHA_TEST_GREATER_THAN, ALPHA_TEST_THRESHOLD);
-				}
+			if (Debris.IsStatic[i])
+			{
+				BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_staticsTextures[mesh.tex]), SAMPLER_LINEAR_CLAMP);
+			}
+			else
+			{
+				BindTexture(TEXTURE_COLOR_MAP, &std::get<0>(m_moveablesTextures[mesh.tex]), SAMPLER_LINEAR_CLAMP);
+			}
 
-				m_stStatic.World = world;
-				m_stStatic.Color = deb->color;
-				m_stStatic.AmbientLight = m_rooms[deb->roomNumber].AmbientLight;
-				m_stStatic.LightMode = deb->lightMode;
-
-				m_cbStatic.updateData(m_stStatic, m_context.Get());
-				BindConstantBufferVS(CB_STATIC, m_cbStatic.get());
-
-				RendererVertex vtx0;
-				vtx0.Position = deb->mesh.Positions[0];
-				vtx0.UV = deb->mesh.TextureCoordinates[0];
-				vtx0.Normal = deb->mesh.Normals[0];
-				vtx0.Color = deb->mesh.Colors[0];
-
-				RendererVertex vtx1;
-				vtx1.Position = deb->mesh.Positions[1];
-				vtx1.UV = deb->mesh.TextureCoordinates[1];
-				vtx1.Normal = deb->mesh.Normals[1];
-				vtx1.Color = deb->mesh.Colors[1];
-
-				RendererVertex vtx2;
-				vtx2.Position = deb->mesh.Positions[2];
-				vtx2.UV = deb->mesh.TextureCoordinates[2];
-				vtx2.Normal = deb->mesh.Normals[2];
-				vtx2.Color = deb->mesh.Colors[2];
-
-				if (lastBlendMode != deb->mesh.blendMode)
-				{
-					lastBlendMode = deb->mesh.blendMode;
-					SetBlendMode(lastBlendMode);
-				}
+			if (rendererPass == RendererPass::Transparent)
+			{
+				SetAlphaTest(ALPHA_TEST_NONE, 1.0f);
+			}
+			else
+			{
+				SetAlphaTest(ALPHA_TEST_GREATER_THAN, ALPHA_TEST_THRESHOLD);
+			}
 
-				SetCullMode(CULL_MODE_NONE);
-				m_primitiveBatch->DrawTriangle(vtx0, vtx1, vtx2);
-				m_numDrawCalls++;
-				m_primitiveBatch->End();
+			m_stStatic.World = world;
+			m_stStatic.Color = Debris.Colors[i];
+			m_stStatic.AmbientLight = m_rooms[Debris.RoomNumbers[i]].AmbientLight;
+			m_stStatic.LightMode = Debris.LightModes[i];
+
+			m_cbStatic.updateData(m_stStatic, m_context.Get());
+			BindConstantBufferVS(CB_STATIC, m_cbStatic.get());
+
+			RendererVertex vtx0;
+			vtx0.Position = mesh.Positions[0];
+			vtx0.UV = mesh.TextureCoordinates[0];
+			vtx0.Normal = mesh.Normals[0];
+			vtx0.Color = mesh.Colors[0];
+
+			RendererVertex vtx1;
+			vtx1.Position = mesh.Positions[1];
+			vtx1.UV = mesh.TextureCoordinates[1];
+			vtx1.Normal = mesh.Normals[1];
+			vtx1.Color = mesh.Colors[1];
+
+			RendererVertex vtx2;
+			vtx2.Position = mesh.Positions[2];
+			vtx2.UV = mesh.TextureCoordinates[2];
+			vtx2.Normal = mesh.Normals[2];
+			vtx2.Color = mesh.Colors[2];
+
+			if (lastBlendMode != mesh.blendMode)
+			{
+				lastBlendMode = mesh.blendMode;
+				SetBlendMode(lastBlendMode);
 			}
+
+			SetCullMode(CULL_MODE_NONE);
+			m_primitiveBatch->DrawTriangle(vtx0, vtx1, vtx2);
+			m_numDrawCalls++;
+			m_primitiveBatch->End();
 		}
 	}
 
@@ -23,30 +23,67 @@ namespace TEN::Renderer
 
 	void Renderer11::CollectRooms(RenderView& renderView, bool onlyRooms)
 	{
-		m_visitedRoomsStack.clear();
-
-		for (int i = 0; i < g_Level.Rooms.size(); i++)
-		{ 
-			RendererRoom* room = &m_rooms[i];
-			                         
-			room->ItemsToDraw.clear();        
-			room->EffectsToDraw.clear();
-			room->TransparentFacesToDraw.clear();
-			room->StaticsToDraw.clear();
-			room->LightsToDraw.clear();
-			room->Visited = false;
-			room->ViewPort = Vector4(-1.0f, -1.0f, 1.0f, 1.0f);
-
-			for (int j = 0; j < room->Doors.size(); j++)
+		// Only rooms collected by previous call can have anything in their draw lists.
+		for (int roomNumber : m_collectedRooms)
+		{
+			auto& room = m_rooms[roomNumber];
+
+			room.ItemsToDraw.clear();
+			room.EffectsToDraw.clear();
+			room.TransparentFacesToDraw.clear();
+			room.StaticsToDraw.clear();
+			room.LightsToDraw.clear();
+		}
+
+		auto cameraPos = Vector3(Camera.pos.x, Camera.pos.y, Camera.pos.z);
+		m_roomVisibility.Update(renderView.Camera.RoomNumber, cameraPos, renderView.Camera.ViewProjection);
+
+		const auto& stats = m_roomVisibility.GetStats();
+		m_numGetVisibleRoomsCalls += stats.RoomVisits;
+		m_numCheckPortalCalls += stats.PortalTests;
+		m_dotProducts += stats.DotProducts;
+
+		m_collectedRooms = m_roomVisibility.GetVisibleRooms();
+
+		// Dynamic light grid covers visible room volume and is rebuilt on first light query.
+		m_dynamicLightGridMin = Vector3(FLT_MAX);
+		m_dynamicLightGridMax = Vector3(-FLT_MAX);
+		for (int roomNumber : m_collectedRooms)
+		{
+			const auto& box = m_rooms[roomNumber].BoundingBox;
+			m_dynamicLightGridMin = Vector3::Min(m_dynamicLightGridMin, Vector3(box.Center) - Vector3(box.Extents));
+			m_dynamicLightGridMax = Vector3::Max(m_dynamicLightGridMax, Vector3(box.Center) + Vector3(box.Extents));
+		}
+
+		if (m_collectedRooms.empty())
+			m_dynamicLightGridMin = m_dynamicLightGridMax = Vector3::Zero;
+
+		m_dynamicLightGridDirty = true;
+
+		for (int roomNumber : m_collectedRooms)
+		{
+			auto& room = m_rooms[roomNumber];
+
+			// Portal viewport is merged with full screen, so scissor test doesn't cut room geometry.
+			const auto& viewPort = m_roomVisibility.GetRoomViewPort(roomNumber);
+			room.ViewPort = Vector4(
+				std::min(-1.0f, viewPort.x),
+				std::min(-1.0f, viewPort.y),
+				std::max(1.0f, viewPort.z),
+				std::max(1.0f, viewPort.w));
+
+			renderView.RoomsToDraw.push_back(&room);
+
+			CollectLightsForRoom(roomNumber, renderView);
+
+			if (!onlyRooms)
 			{
-				room->Doors[j].Visited = false;
-				room->Doors[j].InvisibleFromCamera = false;
-				room->Doors[j].DotProduct = FLT_MAX;
+				CollectItems(roomNumber, renderView);
+				CollectStatics(roomNumber, renderView);
+				CollectEffects(roomNumber);
 			}
 		}
 
-		GetVisibleRooms(NO_ROOM, renderView.Camera.RoomNumber, Vector4(-1.0f, -1.0f, 1.0f, 1.0f), false, 0, onlyRooms, renderView);
-
 		m_invalidateCache = false; 
 
 		// Prepare the real DX scissor test rectangle
@@ -59,8 +96,7 @@ namespace TEN::Renderer
 		} 
 
 		// Collect fog bulbs
-		vector<RendererFogBulb> tempFogBulbs;
-		tempFogBulbs.reserve(MAX_FOG_BULBS_DRAW);
+		m_fogBulbs.clear();
 
 		for (auto& room : m_rooms)     
 		{
@@ -83,232 +119,26 @@ namespace TEN::Renderer
 					bulb.FogBulbToCameraVector = bulb.Position - renderView.Camera.WorldPosition;
 					bulb.Distance = bulb.FogBulbToCameraVector.Length();
 
-					tempFogBulbs.push_back(bulb);
+					m_fogBulbs.push_back(bulb);
 				}
 			}
 		}
 		
 		std::sort(
-			tempFogBulbs.begin(),
-			tempFogBulbs.end(),
+			m_fogBulbs.begin(),
+			m_fogBulbs.end(),
 			[](RendererFogBulb a, RendererFogBulb b)
 			{
 				return a.Distance < b.Distance;
 			}
 		);
 
-		for (int i = 0; i < std::min(MAX_FOG_BULBS_DRAW, (int)tempFogBulbs.size()); i++)
+		for (int i = 0; i < std::min(MAX_FOG_BULBS_DRAW, (int)m_fogBulbs.size()); i++)
 		{
-			renderView.FogBulbsToDraw.push_back(tempFogBulbs[i]);
+			renderView.FogBulbsToDraw.push_back(m_fogBulbs[i]);
 		}
 	}
 
-	bool Renderer11::CheckPortal(short parentRoomNumber, RendererDoor* door, Vector4 viewPort, Vector4* clipPort, RenderView& renderView)
-	{
-		m_numCheckPortalCalls++;
-
-		RendererRoom* room = &m_rooms[parentRoomNumber];
-
-		int  zClip = 0;
-		Vector4 p[4];
-
-		*clipPort = Vector4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-		for (int i = 0; i < 4; i++)
-		{
-			if (!door->Visited)
-			{
-				p[i] = Vector4::Transform(door->AbsoluteVertices[i], renderView.Camera.ViewProjection);
-				if (p[i].w > 0.0f)
-				{
-					p[i].x *= (1.0f / p[i].w);
-					p[i].y *= (1.0f / p[i].w);
-
-				}
-				door->TransformedVertices[i] = p[i];
-			}
-			else
-			{
-				p[i] = door->TransformedVertices[i];
-			}
-
-			if (p[i].w > 0.0f)
-			{
-				clipPort->x = std::min(clipPort->x, p[i].x);
-				clipPort->y = std::min(clipPort->y, p[i].y);
-				clipPort->z = std::max(clipPort->z, p[i].x);
-				clipPort->w = std::max(clipPort->w, p[i].y);
-			}
-			else
-			{
-				zClip++;
-			}
-		}
-
-		door->Visited = true;
-
-		if (zClip == 4)
-		{
-			return false;
-		}
-
-		if (zClip > 0)
-		{
-			for (int i = 0; i < 4; i++) 
-			{
-				Vector4 a = p[i];
-				Vector4 b = p[(i + 1) % 4];
-
-				if ((a.w > 0.0f) ^ (b.w > 0.0f))
-				{
-
-					if (a.x < 0.0f && b.x < 0.0f)
-					{
-						clipPort->x = -1.0f;
-					}
-					else
-					{
-						if (a.x > 0.0f && b.x > 0.0f)
-						{
-							clipPort->z = 1.0f;
-						}
-						else 
-						{
-							clipPort->x = -1.0f;
-							clipPort->z = 1.0f;
-						}
-					}
-
-					if (a.y < 0.0f && b.y < 0.0f)
-					{
-						clipPort->y = -1.0f;
-					}
-					else
-					{
-						if (a.y > 0.0f && b.y > 0.0f)
-						{
-							clipPort->w = 1.0f;
-						}
-						else 
-						{
-							clipPort->y = -1.0f;
-							clipPort->w = 1.0f;
-						}
-					}
-				}
-			}
-		}
-
-		if (clipPort->x > viewPort.z || clipPort->y > viewPort.w || clipPort->z < viewPort.x || clipPort->w < viewPort.y)
-		{
-			return false;
-		}
-
-		clipPort->x = std::max(clipPort->x, viewPort.x);
-		clipPort->y = std::max(clipPort->y, viewPort.y);
-		clipPort->z = std::min(clipPort->z, viewPort.z);
-		clipPort->w = std::min(clipPort->w, viewPort.w);
-
-		return true;
-	}
-
-	void Renderer11::GetVisibleRooms(short from, short to, Vector4 viewPort, bool water, int count, bool onlyRooms, RenderView& renderView)
-	{
-		// FIXME: This is an urgent hack to fix stack overflow crashes.
-		// See https://github.com/MontyTRC89/TombEngine/issues/947 for details.
-		// NOTE by MontyTRC: I'd keep this as a failsafe solution for 0.00000001% of cases we could have problems
-
-		int stackSize = (int)m_visitedRoomsStack.size();
-		int stackMinIndex = std::max(0, int(stackSize - 5));
-
-		for (int i = stackSize - 1; i >= stackMinIndex; i--)
-		{
-			if (m_visitedRoomsStack[i] == to)
-			{
-				TENLog("Circle detected! Room " + std::to_string(to), LogLevel::Warning, LogConfig::Debug);
-				return;
-			}
-		}
-		
-		static constexpr int MAX_SEARCH_DEPTH = 64;
-		if (m_rooms[to].Visited && count > MAX_SEARCH_DEPTH)
-		{
-			TENLog("Maximum room collection depth of " + std::to_string(MAX_SEARCH_DEPTH) + 
-				   " was reached with room " + std::to_string(to), LogLevel::Warning, LogConfig::Debug);
-			return;
-		}
-
-		m_visitedRoomsStack.push_back(to);
-
-		m_numGetVisibleRoomsCalls++;
-
-		RendererRoom* room = &m_rooms[to];
-
-		if (!room->Visited)
-		{
-			room->Visited = true;
-
-			renderView.RoomsToDraw.push_back(room);
-
-			CollectLightsForRoom(to, renderView);
-
-			if (!onlyRooms)
-			{
-				CollectItems(to, renderView);
-				CollectStatics(to, renderView);
-				CollectEffects(to);
-			}
-		}
-
-		room->ViewPort.x = std::min(room->ViewPort.x, viewPort.x);
-		room->ViewPort.y = std::min(room->ViewPort.y, viewPort.y);
-		room->ViewPort.z = std::max(room->ViewPort.z, viewPort.z);
-		room->ViewPort.w = std::max(room->ViewPort.w, viewPort.w);
-
-		Vector4 clipPort;
-		for (int i = 0; i < room->Doors.size(); i++)
-		{
-			RendererDoor* door = &room->Doors[i];
-
-			if (door->InvisibleFromCamera)
-			{
-				continue;
-			}
-
-			if (!door->Visited)
-			{
-				door->CameraToDoor = Vector3(
-					Camera.pos.x - (door->AbsoluteVertices[0].x),
-					Camera.pos.y - (door->AbsoluteVertices[0].y),
-					Camera.pos.z - (door->AbsoluteVertices[0].z));
-				door->CameraToDoor.Normalize();
-			}
-
-			// IMPORTANT: dot = 0 would generate ambiguity becase door could be traversed in both directions, potentially 
-			// generating endless loops. We need to exclude this.
-
-			if (door->DotProduct == FLT_MAX)
-			{
-				door->DotProduct = 
-					door->Normal.x * door->CameraToDoor.x +
-					door->Normal.y * door->CameraToDoor.y +
-					door->Normal.z * door->CameraToDoor.z;
-				m_dotProducts++;
-			}
-
-			if (door->DotProduct <= 0)
-			{
-				door->InvisibleFromCamera = true;
-				continue;
-			}
-
-			if (from != door->RoomNumber && CheckPortal(to, door, viewPort, &clipPort, renderView))
-				GetVisibleRooms(to, door->RoomNumber, clipPort, water, count + 1, onlyRooms, renderView);
-		}
-
-		m_visitedRoomsStack.pop_back();
-	}
-
 	void Renderer11::CollectItems(short roomNumber, RenderView& renderView)
 	{
 		if (m_rooms.size() < roomNumber)
@@ -375,7 +205,7 @@ namespace TEN::Renderer
 					continue;
 			}
 
-			auto newItem = &m_items[itemNum];
+			auto newItem = GetRendererItem(itemNum);
 
 			newItem->ItemNumber = itemNum;
 			newItem->ObjectNumber = item->ObjectNumber;
@@ -488,17 +318,26 @@ namespace TEN::Renderer
 		}
 
 		// Now collect lights from dynamic list and from rooms
-		std::vector<RendererLight*> tempLights;
-		tempLights.reserve(MAX_LIGHTS_DRAW);
+		auto& tempLights = m_tempLights;
+		tempLights.clear();
 		
 		RendererRoom& room = m_rooms[roomNumber];
 
 		RendererLight* brightestLight = nullptr;
 		float brightest = 0.0f;
 
+		if (m_dynamicLightGridDirty)
+		{
+			m_dynamicLightGrid.Build(m_dynamicLights, m_dynamicLightGridMin, m_dynamicLightGridMax);
+			m_dynamicLightGridDirty = false;
+		}
+
 		// Dynamic lights have the priority
-		for (auto& light : m_dynamicLights)
+		m_dynamicLightGrid.GetCandidates(position, radius, m_dynamicLightCandidates);
+		for (int lightIndex : m_dynamicLightCandidates)
 		{
+			auto& light = m_dynamicLights[lightIndex];
+
 			float distanceSquared =
 				SQUARE(position.x - light.Position.x) +
 				SQUARE(position.y - light.Position.y) +
@@ -646,12 +485,15 @@ namespace TEN::Renderer
 			}
 		}
 
-		// Sort lights by distance, if needed
-
+		// Sort lights by distance, if needed. Only nearest ones are used, so rest is left unsorted.
+		// One extra light is kept in case shadow light is skipped below.
 		if (tempLights.size() > MAX_LIGHTS_PER_ITEM)
 		{
-			std::sort(
+			int sortedCount = std::min((int)tempLights.size(), MAX_LIGHTS_PER_ITEM + 1);
+
+			std::partial_sort(
 				tempLights.begin(),
+				tempLights.begin() + sortedCount,
 				tempLights.end(),
 				[](RendererLight* a, RendererLight* b)
 				{
@@ -832,8 +674,8 @@ namespace TEN::Renderer
 
 	void Renderer11::ResetAnimations()
 	{
-		for (int i = 0; i < NUM_ITEMS; i++)
-			m_items[i].DoneAnimations = false;
+		for (auto& item : m_items)
+			item.DoneAnimations = false;
 	}
 
 } // namespace TEN::Renderer
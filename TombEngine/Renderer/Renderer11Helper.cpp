@@ -32,6 +32,7 @@
 #include "Renderer/Renderer11.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
+#include "Specific/memory/Vector.h"
 #include "Specific/trutils.h"
 
 using namespace TEN::Math;
@@ -45,6 +46,12 @@ namespace TEN::Renderer
 	{
 		static auto boneIndices = std::vector<int>{};
 		boneIndices.clear();
+
+		// Interpolate whole skeleton pose in one pass before walking hierarchy.
+		static auto boneOrientations = std::vector<Quaternion>{};
+		int boneCount = GetFramePoseBoneCount(frameData);
+		boneOrientations.resize(boneCount);
+		InterpolateFramePose(frameData, boneOrientations.data(), boneCount);
 		
 		RendererBone* bones[MAX_BONES] = {};
 		int nextBone = 0;
@@ -63,8 +70,7 @@ namespace TEN::Renderer
 			if (bonePtr == nullptr)
 				return;
 
-			if (frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index ||
-				(frameData.Alpha != 0.0f && frameData.FramePtr0->BoneOrientations.size() <= bonePtr->Index))
+			if (bonePtr->Index >= boneCount)
 			{
 				TENLog(
 					"Attempted to animate object with ID " + GetObjectName((GAME_OBJECT_ID)rItem->ObjectNumber) +
@@ -78,21 +84,10 @@ namespace TEN::Renderer
 			if (calculateMatrix)
 			{
 				auto offset0 = frameData.FramePtr0->Offset;
-				auto rotMatrix = Matrix::CreateFromQuaternion(frameData.FramePtr0->BoneOrientations[bonePtr->Index]);
-				
 				if (frameData.Alpha != 0.0f)
-				{
-					auto offset1 = frameData.FramePtr1->Offset;
-					offset0 = Vector3::Lerp(offset0, offset1, frameData.Alpha);
-
-					auto rotMatrix2 = Matrix::CreateFromQuaternion(frameData.FramePtr1->BoneOrientations[bonePtr->Index]);
+					offset0 = Vector3::Lerp(offset0, frameData.FramePtr1->Offset, frameData.Alpha);
 
-					auto quat1 = Quaternion::CreateFromRotationMatrix(rotMatrix);
-					auto quat2 = Quaternion::CreateFromRotationMatrix(rotMatrix2);
-					auto quat3 = Quaternion::Slerp(quat1, quat2, frameData.Alpha);
-
-					rotMatrix = Matrix::CreateFromQuaternion(quat3);
-				}
+				auto rotMatrix = Matrix::CreateFromQuaternion(boneOrientations[bonePtr->Index]);
 
 				auto tMatrix = (bonePtr == rObject.Skeleton) ? Matrix::CreateTranslation(offset0) : Matrix::Identity;
 
@@ -154,7 +149,7 @@ namespace TEN::Renderer
 
 	void Renderer11::UpdateItemAnimations(int itemNumber, bool force)
 	{
-		auto* itemToDraw = &m_items[itemNumber];
+		auto* itemToDraw = GetRendererItem(itemNumber);
 		auto* nativeItem = &g_Level.Items[itemNumber];
 
 		// TODO: hack for fixing a bug, check again if needed
@@ -385,6 +380,12 @@ namespace TEN::Renderer
 		m_rooms[roomNumber1].RoomNumber = roomNumber1;
 		m_rooms[roomNumber2].RoomNumber = roomNumber2;
 
+		m_roomVisibility.Flip(roomNumber1, roomNumber2);
+
+		// Draw lists were swapped along with rooms, so make sure both slots are reset on next collection.
+		m_collectedRooms.push_back(roomNumber1);
+		m_collectedRooms.push_back(roomNumber2);
+
 		m_invalidateCache = true;
 	}
 
@@ -403,6 +404,19 @@ namespace TEN::Renderer
 		}
 	}
 
+	RendererItem* Renderer11::GetRendererItem(int itemNumber)
+	{
+		while (m_items.size() <= itemNumber)
+		{
+			auto& item = m_items.emplace_back();
+			item.ItemNumber = NO_ITEM;
+			item.DoneAnimations = false;
+			item.LightsToDraw = createVector<RendererLight*>(MAX_LIGHTS_PER_ITEM);
+		}
+
+		return &m_items[itemNumber];
+	}
+
 	RendererMesh* Renderer11::GetMesh(int meshIndex)
 	{
 		return m_meshes[meshIndex];
@@ -410,7 +424,7 @@ namespace TEN::Renderer
 
 	int Renderer11::GetSpheres(short itemNumber, BoundingSphere* spheres, char worldSpace, Matrix local)
 	{
-		auto* itemToDraw = &m_items[itemNumber];
+		auto* itemToDraw = GetRendererItem(itemNumber);
 		auto* nativeItem = &g_Level.Items[itemNumber];
 
 		itemToDraw->ItemNumber = itemNumber;
@@ -475,7 +489,7 @@ namespace TEN::Renderer
 		{
 			UpdateItemAnimations(itemNumber, true);
 			
-			auto* rendererItem = &m_items[itemNumber];
+			auto* rendererItem = GetRendererItem(itemNumber);
 			auto* nativeItem = &g_Level.Items[itemNumber];
 
 			auto& obj = *m_moveableObjects[nativeItem->ObjectNumber];
@@ -551,7 +565,7 @@ namespace TEN::Renderer
 
 	Vector3 Renderer11::GetAbsEntityBonePosition(int itemNumber, int jointIndex, const Vector3& relOffset)
 	{
-		auto* rendererItem = &m_items[itemNumber];
+		auto* rendererItem = GetRendererItem(itemNumber);
 
 		rendererItem->ItemNumber = itemNumber;
 
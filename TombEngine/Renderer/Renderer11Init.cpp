@@ -124,10 +124,7 @@ void TEN::Renderer::Renderer11::Initialize(int w, int h, bool windowed, HWND han
 	m_transparentFacesIndices.reserve(MAX_TRANSPARENT_VERTICES); // = createVector<int>(MAX_TRANSPARENT_VERTICES);
 
 	for (int i = 0; i < NUM_ITEMS; i++)
-	{
-		m_items[i].LightsToDraw = createVector<RendererLight*>(MAX_LIGHTS_PER_ITEM);
 		m_effects[i].LightsToDraw = createVector<RendererLight*>(MAX_LIGHTS_PER_ITEM);
-	}
 
 	m_transparentFacesVertexBuffer = VertexBuffer(m_device.Get(), TRANSPARENT_BUCKET_SIZE);
 	m_transparentFacesIndexBuffer = IndexBuffer(m_device.Get(), TRANSPARENT_BUCKET_SIZE);
@@ -404,6 +401,7 @@ void Renderer11::InitializeCommonTextures()
 	SetTextureOrDefault(m_loadingBarInner, GetAssetPath(L"Textures/LoadingBarInner.png"));
 	SetTextureOrDefault(m_whiteTexture, GetAssetPath(L"Textures/WhiteSprite.png"));
 
+	m_whiteSprite.Index = 0;
 	m_whiteSprite.Height = m_whiteTexture.Height;
 	m_whiteSprite.Width = m_whiteTexture.Width;
 	m_whiteSprite.UV[0] = Vector2(0.0f, 0.0f);
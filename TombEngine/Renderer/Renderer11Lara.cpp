@@ -79,7 +79,7 @@ bool shouldAnimateUpperBody(const LaraWeaponType& weapon)
 
 void Renderer11::UpdateLaraAnimations(bool force)
 {
-	auto& rItem = m_items[LaraItem->Index];
+	auto& rItem = *GetRendererItem(LaraItem->Index);
 	rItem.ItemNumber = LaraItem->Index;
 
 	if (!force && rItem.DoneAnimations)
@@ -285,7 +285,7 @@ void TEN::Renderer::Renderer11::DrawLara(RenderView& view, RendererPass renderer
 	if (CurrentLevel == 0 && !g_GameFlow->IsLaraInTitleEnabled())
 		return;
 
-	auto* item = &m_items[LaraItem->Index];
+	auto* item = GetRendererItem(LaraItem->Index);
 	auto* nativeItem = &g_Level.Items[item->ItemNumber];
 
 	if (nativeItem->Flags & IFLAG_INVISIBLE)
@@ -349,10 +349,12 @@ void Renderer11::DrawLaraHair(RendererItem* itemToDraw, RendererRoom* room, Rend
 	// TODO
 	bool isYoung = (g_GameFlow->GetLevel(CurrentLevel)->GetLaraType() == LaraType::Young);
 
+	const auto& hairSolver = HairEffect.Solver;
+
 	bool isHead = true;
-	for (const auto& unit : HairEffect.Units)
+	for (int unitIndex = 0; unitIndex < hairSolver.GetStrandCount(); unitIndex++)
 	{
-		if (!unit.IsEnabled)
+		if (!hairSolver.IsStrandEnabled(unitIndex))
 			continue;
 
 		// First matrix is Lara's head matrix, then all hair unit segment matrices.
@@ -360,10 +362,12 @@ void Renderer11::DrawLaraHair(RendererItem* itemToDraw, RendererRoom* room, Rend
 		m_stItem.World = Matrix::Identity;
 		m_stItem.BonesMatrices[0] = itemToDraw->AnimationTransforms[LM_HEAD] * m_LaraWorldMatrix;
 
-		for (int i = 0; i < unit.Segments.size(); i++)
+		const auto* positions = hairSolver.GetPositions(unitIndex);
+		const auto* orientations = hairSolver.GetOrientations(unitIndex);
+
+		for (int i = 0; i < hairSolver.GetSegmentCount(); i++)
 		{
-			const auto& segment = unit.Segments[i];
-			auto worldMatrix = Matrix::CreateFromQuaternion(segment.Orientation) * Matrix::CreateTranslation(segment.Position);
+			auto worldMatrix = Matrix::CreateFromQuaternion(orientations[i]) * Matrix::CreateTranslation(positions[i]);
 
 			m_stItem.BonesMatrices[i + 1] = worldMatrix;
 			m_stItem.BoneLightModes[i] = LIGHT_MODES::LIGHT_MODE_DYNAMIC;
@@ -1,8 +1,6 @@
 #include "framework.h"
 #include "Renderer/Renderer11.h"
 
-#include "Specific/trutils.h"
-
 namespace TEN::Renderer
 {
 	void Renderer11::AddDebugString(const std::string& string, const Vector2& pos, const Color& color, float scale, int flags, RENDERER_DEBUG_PAGE page)
@@ -40,21 +38,20 @@ namespace TEN::Renderer
 			float fontSpacing = m_gameFont->GetLineSpacing();
 			float fontScale = REFERENCE_FONT_SIZE / fontSpacing;
 
-			auto stringLines = SplitString(string);
+			const auto& layout = GetStringLayout(string);
 			float yOffset = 0.0f;
-			for (const auto& line : stringLines)
+			for (const auto& line : layout.Lines)
 			{
 				// Prepare structure for renderer.
 				RendererStringToDraw rString;
-				rString.String = TEN::Utils::ToWString(line);
+				rString.String = &line.String;
 				rString.Flags = flags;
 				rString.X = 0;
 				rString.Y = 0;
 				rString.Color = color.ToVector3();
 				rString.Scale = (uiScale * fontScale) * scale;
 
-				// Measure string.
-				auto size = Vector2(m_gameFont->MeasureString(rString.String.c_str())) * rString.Scale;
+				auto size = line.Size * rString.Scale;
 
 				rString.X = (flags & PRINTSTRING_CENTER) ? ((pos.x * factor.x) - (size.x / 2.0f)) : (pos.x * factor.x);
 				rString.Y = (pos.y * uiScale) + yOffset;
@@ -87,6 +84,11 @@ namespace TEN::Renderer
 		}
 	}
 
+	const RendererStringLayout& Renderer11::GetStringLayout(const std::string& string)
+	{
+		return m_stringLayouts.Get(string, [this](const std::wstring& line) { return Vector2(m_gameFont->MeasureString(line.c_str())); });
+	}
+
 	void Renderer11::DrawAllStrings()
 	{
 		float shadowOffset = 1.5f / (REFERENCE_FONT_SIZE / m_gameFont->GetLineSpacing());
@@ -99,7 +101,7 @@ namespace TEN::Renderer
 			if (rString.Flags & PRINTSTRING_OUTLINE)
 			{
 				m_gameFont->DrawString(
-					m_spriteBatch.get(), rString.String.c_str(),
+					m_spriteBatch.get(), rString.String->c_str(),
 					Vector2(rString.X + shadowOffset * rString.Scale, rString.Y + shadowOffset * rString.Scale),
 					Vector4(0.0f, 0.0f, 0.0f, 1.0f) * ScreenFadeCurrent,
 					0.0f, Vector4::Zero, rString.Scale);
@@ -107,7 +109,7 @@ namespace TEN::Renderer
 
 			// Draw string.
 			m_gameFont->DrawString(
-				m_spriteBatch.get(), rString.String.c_str(),
+				m_spriteBatch.get(), rString.String->c_str(),
 				Vector2(rString.X, rString.Y),
 				Vector4(rString.Color.x, rString.Color.y, rString.Color.z, 1.0f) * ScreenFadeCurrent,
 				0.0f, Vector4::Zero, rString.Scale);
@@ -117,5 +119,8 @@ namespace TEN::Renderer
 
 		IsBlinkUpdated = false;
 		m_strings.clear();
+
+		// Evict unprinted layouts only after drawing, since drawn strings point into them.
+		m_stringLayouts.EndFrame();
 	}
 }
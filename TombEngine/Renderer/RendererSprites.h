@@ -36,4 +36,19 @@ namespace TEN::Renderer
 		bool SoftParticle;
 		SpriteRenderType renderType = SpriteRenderType::Default;
 	};
+
+	// Range of sprites which can be drawn with single instanced call.
+	struct RendererSpriteBucket
+	{
+		RendererSprite* Sprite;
+		BLEND_MODES BlendMode;
+
+		int FirstSprite = 0; // Index into renderer's bucket sprite list.
+		int SpriteCount = 0;
+
+		bool IsBillboard	= false;
+		bool IsSoftParticle = false;
+
+		SpriteRenderType RenderType;
+	};
 }
@@ -0,0 +1,665 @@
+#include "framework.h"
+#include "Renderer/RoomVisibility.h"
+
+#include <chrono>
+
+#include "Game/room.h"
+
+namespace TEN::Renderer
+{
+	// Guards against portal setups which loop back into themselves.
+	constexpr auto CYCLE_CHECK_DEPTH = 5;
+	constexpr auto MAX_SEARCH_DEPTH	 = 64;
+
+	const auto FULL_VIEWPORT = Vector4(-1.0f, -1.0f, 1.0f, 1.0f);
+
+	void RoomVisibility::Initialize(const std::vector<ROOM_INFO>& rooms)
+	{
+		m_rooms.clear();
+		m_rooms.resize(rooms.size());
+		m_visibleRooms.clear();
+		m_nodes.clear();
+		m_stack.clear();
+		m_frame = 0;
+		m_stats = {};
+
+		for (int i = 0; i < rooms.size(); i++)
+		{
+			const auto& room = rooms[i];
+			auto& portals = m_rooms[i].Portals;
+
+			portals.resize(room.doors.size());
+			for (int j = 0; j < room.doors.size(); j++)
+			{
+				const auto& door = room.doors[j];
+				auto& portal = portals[j];
+
+				portal.RoomNumber = door.room;
+				portal.Normal = door.normal;
+
+				for (int k = 0; k < 4; k++)
+				{
+					portal.VertexX[k] = room.x + door.vertices[k].x;
+					portal.VertexY[k] = room.y + door.vertices[k].y;
+					portal.VertexZ[k] = room.z + door.vertices[k].z;
+				}
+			}
+		}
+	}
+
+	void RoomVisibility::Flip(int roomNumber0, int roomNumber1)
+	{
+		if (roomNumber0 < 0 || roomNumber0 >= m_rooms.size() ||
+			roomNumber1 < 0 || roomNumber1 >= m_rooms.size())
+		{
+			return;
+		}
+
+		std::swap(m_rooms[roomNumber0].Portals, m_rooms[roomNumber1].Portals);
+	}
+
+	void RoomVisibility::Update(int cameraRoomNumber, const Vector3& cameraPosition, const Matrix& viewProjection)
+	{
+		m_visibleRooms.clear();
+		m_nodes.clear();
+		m_stack.clear();
+
+		// Per-frame state is tagged with frame number instead of being cleared, so only
+		// rooms and portals which are actually reached are touched.
+		m_frame++;
+		if (m_frame == 0)
+		{
+			for (auto& room : m_rooms)
+			{
+				room.VisitFrame = 0;
+				for (auto& portal : room.Portals)
+					portal.FacingFrame = portal.ProjectionFrame = 0;
+			}
+
+			m_frame = 1;
+		}
+
+		if (cameraRoomNumber < 0 || cameraRoomNumber >= m_rooms.size())
+			return;
+
+		m_cameraPosition = cameraPosition;
+		m_viewProjection = viewProjection;
+
+		auto root = Node{};
+		root.To = cameraRoomNumber;
+		root.ViewPort = FULL_VIEWPORT;
+		m_nodes.push_back(root);
+		m_stack.push_back(0);
+
+		while (!m_stack.empty())
+		{
+			int nodeIndex = m_stack.back();
+			m_stack.pop_back();
+
+			VisitRoom(nodeIndex);
+		}
+	}
+
+	const std::vector<int>& RoomVisibility::GetVisibleRooms() const
+	{
+		return m_visibleRooms;
+	}
+
+	const Vector4& RoomVisibility::GetRoomViewPort(int roomNumber) const
+	{
+		return m_rooms[roomNumber].ViewPort;
+	}
+
+	const RoomVisibilityStats& RoomVisibility::GetStats() const
+	{
+		return m_stats;
+	}
+
+	bool RoomVisibility::IsCycle(const Node& node) const
+	{
+		int parent = node.Parent;
+		for (int i = 0; i < CYCLE_CHECK_DEPTH && parent >= 0; i++)
+		{
+			if (m_nodes[parent].To == node.To)
+				return true;
+
+			parent = m_nodes[parent].Parent;
+		}
+
+		return false;
+	}
+
+	bool RoomVisibility::IsPortalFacing(Portal& portal)
+	{
+		if (portal.FacingFrame == m_frame)
+			return portal.IsFacing;
+
+		auto cameraToPortal = Vector3(
+			m_cameraPosition.x - portal.VertexX[0],
+			m_cameraPosition.y - portal.VertexY[0],
+			m_cameraPosition.z - portal.VertexZ[0]);
+		cameraToPortal.Normalize();
+
+		// IMPORTANT: dot = 0 would generate ambiguity because portal could be traversed in both directions,
+		// potentially generating endless loops. We need to exclude this.
+		portal.IsFacing = (portal.Normal.Dot(cameraToPortal) > 0.0f);
+		portal.FacingFrame = m_frame;
+		m_stats.DotProducts++;
+
+		return portal.IsFacing;
+	}
+
+	void RoomVisibility::ProjectPortal(Portal& portal)
+	{
+		if (portal.ProjectionFrame == m_frame)
+			return;
+
+		const auto& m = m_viewProjection;
+
+		auto x = XMLoadFloat4A((const XMFLOAT4A*)portal.VertexX);
+		auto y = XMLoadFloat4A((const XMFLOAT4A*)portal.VertexY);
+		auto z = XMLoadFloat4A((const XMFLOAT4A*)portal.VertexZ);
+
+		// Row vector convention: p' = x * row1 + y * row2 + z * row3 + row4.
+		auto px = XMVectorMultiplyAdd(x, XMVectorReplicate(m._11), XMVectorMultiplyAdd(y, XMVectorReplicate(m._21), XMVectorMultiplyAdd(z, XMVectorReplicate(m._31), XMVectorReplicate(m._41))));
+		auto py = XMVectorMultiplyAdd(x, XMVectorReplicate(m._12), XMVectorMultiplyAdd(y, XMVectorReplicate(m._22), XMVectorMultiplyAdd(z, XMVectorReplicate(m._32), XMVectorReplicate(m._42))));
+		auto pw = XMVectorMultiplyAdd(x, XMVectorReplicate(m._14), XMVectorMultiplyAdd(y, XMVectorReplicate(m._24), XMVectorMultiplyAdd(z, XMVectorReplicate(m._34), XMVectorReplicate(m._44))));
+
+		// Perspective divide only vertices in front of camera.
+		auto inFront = XMVectorGreater(pw, XMVectorZero());
+		auto invW = XMVectorReciprocal(pw);
+		px = XMVectorSelect(px, XMVectorMultiply(px, invW), inFront);
+		py = XMVectorSelect(py, XMVectorMultiply(py, invW), inFront);
+
+		XMStoreFloat4A((XMFLOAT4A*)portal.ProjectedX, px);
+		XMStoreFloat4A((XMFLOAT4A*)portal.ProjectedY, py);
+		XMStoreFloat4A((XMFLOAT4A*)portal.ProjectedW, pw);
+
+		portal.ProjectionFrame = m_frame;
+	}
+
+	bool RoomVisibility::ClipPortal(Portal& portal, const Vector4& viewPort, Vector4& clipPort)
+	{
+		m_stats.PortalTests++;
+
+		ProjectPortal(portal);
+
+		const float* x = portal.ProjectedX;
+		const float* y = portal.ProjectedY;
+		const float* w = portal.ProjectedW;
+
+		clipPort = Vector4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+		int zClip = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			if (w[i] > 0.0f)
+			{
+				clipPort.x = std::min(clipPort.x, x[i]);
+				clipPort.y = std::min(clipPort.y, y[i]);
+				clipPort.z = std::max(clipPort.z, x[i]);
+				clipPort.w = std::max(clipPort.w, y[i]);
+			}
+			else
+			{
+				zClip++;
+			}
+		}
+
+		if (zClip == 4)
+			return false;
+
+		// Portal crosses near plane; extend clip rectangle to screen edges it may reach.
+		if (zClip > 0)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				int j = (i + 1) % 4;
+
+				if ((w[i] > 0.0f) == (w[j] > 0.0f))
+					continue;
+
+				if (x[i] < 0.0f && x[j] < 0.0f)
+				{
+					clipPort.x = -1.0f;
+				}
+				else if (x[i] > 0.0f && x[j] > 0.0f)
+				{
+					clipPort.z = 1.0f;
+				}
+				else
+				{
+					clipPort.x = -1.0f;
+					clipPort.z = 1.0f;
+				}
+
+				if (y[i] < 0.0f && y[j] < 0.0f)
+				{
+					clipPort.y = -1.0f;
+				}
+				else if (y[i] > 0.0f && y[j] > 0.0f)
+				{
+					clipPort.w = 1.0f;
+				}
+				else
+				{
+					clipPort.y = -1.0f;
+					clipPort.w = 1.0f;
+				}
+			}
+		}
+
+		if (clipPort.x > viewPort.z || clipPort.y > viewPort.w || clipPort.z < viewPort.x || clipPort.w < viewPort.y)
+			return false;
+
+		clipPort.x = std::max(clipPort.x, viewPort.x);
+		clipPort.y = std::max(clipPort.y, viewPort.y);
+		clipPort.z = std::min(clipPort.z, viewPort.z);
+		clipPort.w = std::min(clipPort.w, viewPort.w);
+		return true;
+	}
+
+	void RoomVisibility::VisitRoom(int nodeIndex)
+	{
+		// Copy, as node array may grow below.
+		auto node = m_nodes[nodeIndex];
+
+		if (IsCycle(node))
+		{
+			TENLog("Circle detected! Room " + std::to_string(node.To), LogLevel::Warning, LogConfig::Debug);
+			return;
+		}
+
+		auto& room = m_rooms[node.To];
+
+		if (room.VisitFrame == m_frame && node.Depth > MAX_SEARCH_DEPTH)
+		{
+			TENLog("Maximum room collection depth of " + std::to_string(MAX_SEARCH_DEPTH) +
+				   " was reached with room " + std::to_string(node.To), LogLevel::Warning, LogConfig::Debug);
+			return;
+		}
+
+		m_stats.RoomVisits++;
+
+		if (room.VisitFrame != m_frame)
+		{
+			room.VisitFrame = m_frame;
+			room.ViewPort = node.ViewPort;
+			m_visibleRooms.push_back(node.To);
+		}
+		else
+		{
+			room.ViewPort.x = std::min(room.ViewPort.x, node.ViewPort.x);
+			room.ViewPort.y = std::min(room.ViewPort.y, node.ViewPort.y);
+			room.ViewPort.z = std::max(room.ViewPort.z, node.ViewPort.z);
+			room.ViewPort.w = std::max(room.ViewPort.w, node.ViewPort.w);
+		}
+
+		int firstChild = (int)m_nodes.size();
+
+		auto clipPort = Vector4::Zero;
+		for (auto& portal : room.Portals)
+		{
+			if (!IsPortalFacing(portal))
+				continue;
+
+			if (portal.RoomNumber == node.From || portal.RoomNumber < 0 || portal.RoomNumber >= m_rooms.size())
+				continue;
+
+			if (!ClipPortal(portal, node.ViewPort, clipPort))
+				continue;
+
+			auto child = Node{};
+			child.From = node.To;
+			child.To = portal.RoomNumber;
+			child.Parent = nodeIndex;
+			child.Depth = node.Depth + 1;
+			child.ViewPort = clipPort;
+			m_nodes.push_back(child);
+		}
+
+		// Push in reverse, so rooms are visited in same depth-first order as portals are listed.
+		for (int i = (int)m_nodes.size() - 1; i >= firstChild; i--)
+			m_stack.push_back(i);
+	}
+
+	// Recursive traversal which RoomVisibility replaced, kept only as reference for benchmark.
+	class LegacyRoomVisibility
+	{
+	private:
+		struct Door
+		{
+			Vector4 AbsoluteVertices[4]	   = {};
+			Vector4 TransformedVertices[4] = {};
+			Vector3 Normal				   = Vector3::Zero;
+			Vector3 CameraToDoor		   = Vector3::Zero;
+			float	DotProduct			   = FLT_MAX;
+			int		RoomNumber			   = -1;
+			bool	Visited				   = false;
+			bool	InvisibleFromCamera	   = false;
+		};
+
+		struct Room
+		{
+			std::vector<Door> Doors	   = {};
+			Vector4			  ViewPort = FULL_VIEWPORT;
+			bool			  Visited  = false;
+		};
+
+		std::vector<Room> m_rooms			   = {};
+		std::vector<int>  m_visitedRoomsStack = {};
+		std::vector<int>  m_visibleRooms	   = {};
+		Vector3			  m_cameraPosition	   = Vector3::Zero;
+		Matrix			  m_viewProjection	   = Matrix::Identity;
+
+	public:
+		void Initialize(const std::vector<ROOM_INFO>& rooms)
+		{
+			m_rooms.resize(rooms.size());
+			for (int i = 0; i < rooms.size(); i++)
+			{
+				const auto& room = rooms[i];
+
+				m_rooms[i].Doors.resize(room.doors.size());
+				for (int j = 0; j < room.doors.size(); j++)
+				{
+					auto& door = m_rooms[i].Doors[j];
+					door.RoomNumber = room.doors[j].room;
+					door.Normal = room.doors[j].normal;
+
+					for (int k = 0; k < 4; k++)
+					{
+						door.AbsoluteVertices[k] = Vector4(
+							room.x + room.doors[j].vertices[k].x,
+							room.y + room.doors[j].vertices[k].y,
+							room.z + room.doors[j].vertices[k].z,
+							1.0f);
+					}
+				}
+			}
+		}
+
+		void Update(int cameraRoomNumber, const Vector3& cameraPosition, const Matrix& viewProjection)
+		{
+			m_visitedRoomsStack.clear();
+			m_visibleRooms.clear();
+			m_cameraPosition = cameraPosition;
+			m_viewProjection = viewProjection;
+
+			for (auto& room : m_rooms)
+			{
+				room.Visited = false;
+				room.ViewPort = FULL_VIEWPORT;
+
+				for (auto& door : room.Doors)
+				{
+					door.Visited = false;
+					door.InvisibleFromCamera = false;
+					door.DotProduct = FLT_MAX;
+				}
+			}
+
+			GetVisibleRooms(NO_ROOM, cameraRoomNumber, FULL_VIEWPORT, 0);
+		}
+
+		const std::vector<int>& GetVisibleRooms() const
+		{
+			return m_visibleRooms;
+		}
+
+		const Vector4& GetRoomViewPort(int roomNumber) const
+		{
+			return m_rooms[roomNumber].ViewPort;
+		}
+
+	private:
+		bool CheckPortal(Door& door, const Vector4& viewPort, Vector4& clipPort)
+		{
+			Vector4 p[4];
+			int zClip = 0;
+
+			clipPort = Vector4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+			for (int i = 0; i < 4; i++)
+			{
+				if (!door.Visited)
+				{
+					p[i] = Vector4::Transform(door.AbsoluteVertices[i], m_viewProjection);
+					if (p[i].w > 0.0f)
+					{
+						p[i].x *= (1.0f / p[i].w);
+						p[i].y *= (1.0f / p[i].w);
+					}
+
+					door.TransformedVertices[i] = p[i];
+				}
+				else
+				{
+					p[i] = door.TransformedVertices[i];
+				}
+
+				if (p[i].w > 0.0f)
+				{
+					clipPort.x = std::min(clipPort.x, p[i].x);
+					clipPort.y = std::min(clipPort.y, p[i].y);
+					clipPort.z = std::max(clipPort.z, p[i].x);
+					clipPort.w = std::max(clipPort.w, p[i].y);
+				}
+				else
+				{
+					zClip++;
+				}
+			}
+
+			door.Visited = true;
+
+			if (zClip == 4)
+				return false;
+
+			if (zClip > 0)
+			{
+				for (int i = 0; i < 4; i++)
+				{
+					auto a = p[i];
+					auto b = p[(i + 1) % 4];
+
+					if ((a.w > 0.0f) ^ (b.w > 0.0f))
+					{
+						if (a.x < 0.0f && b.x < 0.0f)
+						{
+							clipPort.x = -1.0f;
+						}
+						else if (a.x > 0.0f && b.x > 0.0f)
+						{
+							clipPort.z = 1.0f;
+						}
+						else
+						{
+							clipPort.x = -1.0f;
+							clipPort.z = 1.0f;
+						}
+
+						if (a.y < 0.0f && b.y < 0.0f)
+						{
+							clipPort.y = -1.0f;
+						}
+						else if (a.y > 0.0f && b.y > 0.0f)
+						{
+							clipPort.w = 1.0f;
+						}
+						else
+						{
+							clipPort.y = -1.0f;
+							clipPort.w = 1.0f;
+						}
+					}
+				}
+			}
+
+			if (clipPort.x > viewPort.z || clipPort.y > viewPort.w || clipPort.z < viewPort.x || clipPort.w < viewPort.y)
+				return false;
+
+			clipPort.x = std::max(clipPort.x, viewPort.x);
+			clipPort.y = std::max(clipPort.y, viewPort.y);
+			clipPort.z = std::min(clipPort.z, viewPort.z);
+			clipPort.w = std::min(clipPort.w, viewPort.w);
+			return true;
+		}
+
+		void GetVisibleRooms(int from, int to, const Vector4& viewPort, int count)
+		{
+			int stackSize = (int)m_visitedRoomsStack.size();
+			for (int i = stackSize - 1; i >= std::max(0, stackSize - CYCLE_CHECK_DEPTH); i--)
+			{
+				if (m_visitedRoomsStack[i] == to)
+					return;
+			}
+
+			auto& room = m_rooms[to];
+			if (room.Visited && count > MAX_SEARCH_DEPTH)
+				return;
+
+			m_visitedRoomsStack.push_back(to);
+
+			if (!room.Visited)
+			{
+				room.Visited = true;
+				m_visibleRooms.push_back(to);
+			}
+
+			room.ViewPort.x = std::min(room.ViewPort.x, viewPort.x);
+			room.ViewPort.y = std::min(room.ViewPort.y, viewPort.y);
+			room.ViewPort.z = std::max(room.ViewPort.z, viewPort.z);
+			room.ViewPort.w = std::max(room.ViewPort.w, viewPort.w);
+
+			auto clipPort = Vector4::Zero;
+			for (auto& door : room.Doors)
+			{
+				if (door.InvisibleFromCamera)
+					continue;
+
+				if (!door.Visited)
+				{
+					door.CameraToDoor = Vector3(
+						m_cameraPosition.x - door.AbsoluteVertices[0].x,
+						m_cameraPosition.y - door.AbsoluteVertices[0].y,
+						m_cameraPosition.z - door.AbsoluteVertices[0].z);
+					door.CameraToDoor.Normalize();
+				}
+
+				if (door.DotProduct == FLT_MAX)
+					door.DotProduct = door.Normal.Dot(door.CameraToDoor);
+
+				if (door.DotProduct <= 0.0f)
+				{
+					door.InvisibleFromCamera = true;
+					continue;
+				}
+
+				if (from != door.RoomNumber && CheckPortal(door, viewPort, clipPort))
+					GetVisibleRooms(to, door.RoomNumber, clipPort, count + 1);
+			}
+
+			m_visitedRoomsStack.pop_back();
+		}
+	};
+
+	// Renders each room from its center in several directions with both traversals, compares
+	// collected rooms and their viewports, and logs time taken by each.
+	bool BenchmarkRoomVisibility(const std::vector<ROOM_INFO>& rooms)
+	{
+		constexpr auto HEADING_COUNT		= 8;
+		constexpr auto PITCH_COUNT			= 3;
+		constexpr auto ITERATION_COUNT		= 10;
+		constexpr auto VIEWPORT_TOLERANCE	= 0.001f;
+
+		// Same projection as game camera at default field of view.
+		auto projection = Matrix::CreatePerspectiveFieldOfView(80.0f * RADIAN, 16.0f / 9.0f, 20.0f, BLOCK(100));
+
+		struct BenchmarkCamera
+		{
+			int		RoomNumber	   = 0;
+			Vector3 Position	   = Vector3::Zero;
+			Matrix	ViewProjection = Matrix::Identity;
+		};
+
+		auto cameras = std::vector<BenchmarkCamera>{};
+		for (int i = 0; i < rooms.size(); i++)
+		{
+			const auto& room = rooms[i];
+			auto pos = Vector3(
+				room.x + (room.xSize * BLOCK(1)) / 2.0f,
+				(room.minfloor + room.maxceiling) / 2.0f,
+				room.z + (room.zSize * BLOCK(1)) / 2.0f);
+
+			for (int heading = 0; heading < HEADING_COUNT; heading++)
+			{
+				for (int pitch = 0; pitch < PITCH_COUNT; pitch++)
+				{
+					float yaw = heading * (PI_MUL_2 / HEADING_COUNT);
+					float tilt = (pitch - (PITCH_COUNT / 2)) * (PI / 6.0f);
+					auto dir = Vector3(sin(yaw) * cos(tilt), sin(tilt), cos(yaw) * cos(tilt));
+					auto view = Matrix::CreateLookAt(pos, pos + dir, -Vector3::UnitY);
+
+					cameras.push_back(BenchmarkCamera{ i, pos, view * projection });
+				}
+			}
+		}
+
+		auto visibility = RoomVisibility();
+		auto legacyVisibility = LegacyRoomVisibility();
+		visibility.Initialize(rooms);
+		legacyVisibility.Initialize(rooms);
+
+		int setMismatchCount = 0;
+		int viewPortMismatchCount = 0;
+		for (const auto& camera : cameras)
+		{
+			visibility.Update(camera.RoomNumber, camera.Position, camera.ViewProjection);
+			legacyVisibility.Update(camera.RoomNumber, camera.Position, camera.ViewProjection);
+
+			const auto& visibleRooms = visibility.GetVisibleRooms();
+			if (visibleRooms != legacyVisibility.GetVisibleRooms())
+			{
+				setMismatchCount++;
+				continue;
+			}
+
+			// Legacy viewport starts at full screen, same as renderer merges it.
+			for (int roomNumber : visibleRooms)
+			{
+				auto viewPort = visibility.GetRoomViewPort(roomNumber);
+				viewPort = Vector4(std::min(-1.0f, viewPort.x), std::min(-1.0f, viewPort.y), std::max(1.0f, viewPort.z), std::max(1.0f, viewPort.w));
+
+				auto delta = viewPort - legacyVisibility.GetRoomViewPort(roomNumber);
+				if (std::max({ abs(delta.x), abs(delta.y), abs(delta.z), abs(delta.w) }) > VIEWPORT_TOLERANCE)
+				{
+					viewPortMismatchCount++;
+					break;
+				}
+			}
+		}
+
+		auto measure = [&](auto& roomVisibility)
+		{
+			auto startTime = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < ITERATION_COUNT; i++)
+			{
+				for (const auto& camera : cameras)
+					roomVisibility.Update(camera.RoomNumber, camera.Position, camera.ViewProjection);
+			}
+
+			auto endTime = std::chrono::high_resolution_clock::now();
+			return (std::chrono::duration<double, std::micro>(endTime - startTime).count() / (ITERATION_COUNT * std::max((int)cameras.size(), 1)));
+		};
+
+		double time = measure(visibility);
+		double legacyTime = measure(legacyVisibility);
+
+		TENLog("Room visibility: " + std::to_string(cameras.size()) + " cameras, " + std::to_string(setMismatchCount) + " room set mismatches, " +
+			   std::to_string(viewPortMismatchCount) + " viewport mismatches. " + std::to_string(time) + " us per update (recursive " +
+			   std::to_string(legacyTime) + " us).", LogLevel::Info);
+
+		return (setMismatchCount == 0 && viewPortMismatchCount == 0);
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+struct ROOM_INFO;
+
+namespace TEN::Renderer
+{
+	struct RoomVisibilityStats
+	{
+		int RoomVisits	= 0;
+		int PortalTests = 0;
+		int DotProducts = 0;
+	};
+
+	// CPU-only room and portal visibility. Doesn't depend on graphics device, so it can be
+	// run against loaded level and any camera without renderer.
+	class RoomVisibility
+	{
+	public:
+		RoomVisibility() = default;
+
+		void Initialize(const std::vector<ROOM_INFO>& rooms);
+		void Flip(int roomNumber0, int roomNumber1);
+		void Update(int cameraRoomNumber, const Vector3& cameraPosition, const Matrix& viewProjection);
+
+		const std::vector<int>&	   GetVisibleRooms() const;
+		const Vector4&			   GetRoomViewPort(int roomNumber) const;
+		const RoomVisibilityStats& GetStats() const;
+
+	private:
+		// Vertices are stored per axis, so all 4 can be projected at once.
+		struct alignas(16) Portal
+		{
+			float VertexX[4] = {};
+			float VertexY[4] = {};
+			float VertexZ[4] = {};
+
+			// Projection results, valid only when ProjectionFrame matches current frame.
+			float ProjectedX[4] = {};
+			float ProjectedY[4] = {};
+			float ProjectedW[4] = {};
+
+			Vector3		 Normal			 = Vector3::Zero;
+			int			 RoomNumber		 = -1;
+			unsigned int FacingFrame	 = 0;
+			unsigned int ProjectionFrame = 0;
+			bool		 IsFacing		 = false;
+		};
+
+		struct Room
+		{
+			std::vector<Portal> Portals	   = {};
+			Vector4				ViewPort   = Vector4::Zero;
+			unsigned int		VisitFrame = 0;
+		};
+
+		struct Node
+		{
+			int		From	 = -1;
+			int		To		 = -1;
+			int		Parent	 = -1;
+			int		Depth	 = 0;
+			Vector4 ViewPort = Vector4::Zero;
+		};
+
+		std::vector<Room> m_rooms		 = {};
+		std::vector<int>  m_visibleRooms = {};
+		std::vector<Node> m_nodes		 = {};
+		std::vector<int>  m_stack		 = {};
+
+		unsigned int		m_frame			 = 0;
+		Vector3				m_cameraPosition = Vector3::Zero;
+		Matrix				m_viewProjection = Matrix::Identity;
+		RoomVisibilityStats m_stats			 = {};
+
+		bool IsCycle(const Node& node) const;
+		bool IsPortalFacing(Portal& portal);
+		void ProjectPortal(Portal& portal);
+		bool ClipPortal(Portal& portal, const Vector4& viewPort, Vector4& clipPort);
+		void VisitRoom(int nodeIndex);
+	};
+
+	bool BenchmarkRoomVisibility(const std::vector<ROOM_INFO>& rooms);
+}
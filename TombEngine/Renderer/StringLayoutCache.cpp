@@ -0,0 +1,192 @@
+#include "framework.h"
+#include "Renderer/StringLayoutCache.h"
+
+#include <chrono>
+
+#include "Specific/trutils.h"
+
+namespace TEN::Renderer
+{
+	constexpr auto STRING_LAYOUT_UNUSED_FRAME_MAX = 60; // Layouts not printed for this many frames are evicted.
+
+	static RendererStringLayout CreateStringLayout(const std::string& string, const StringLayoutCache::MeasureFunction& measure)
+	{
+		auto layout = RendererStringLayout{};
+		for (const auto& line : TEN::Utils::SplitString(string))
+		{
+			auto wString = TEN::Utils::ToWString(line);
+			auto size = measure(wString);
+			layout.Lines.push_back(RendererStringLine{ wString, size });
+		}
+
+		return layout;
+	}
+
+	int StringLayoutCache::GetCount() const
+	{
+		return (int)m_layouts.size();
+	}
+
+	// Splitting, converting and measuring string is only done when it is printed for the first time.
+	// Layout doesn't depend on position, scale or flags, so it is shared by all prints of same text.
+	const RendererStringLayout& StringLayoutCache::Get(const std::string& string, const MeasureFunction& measure)
+	{
+		auto it = m_layouts.find(string);
+		if (it == m_layouts.end())
+			it = m_layouts.emplace(string, CreateStringLayout(string, measure)).first;
+
+		it->second.LastUsedFrame = m_frame;
+		return it->second;
+	}
+
+	// Evicts layouts of strings which are no longer printed, e.g. changing counters.
+	// Must only be called after drawing, since drawn strings point into layouts.
+	void StringLayoutCache::EndFrame()
+	{
+		m_frame++;
+		if ((m_frame % STRING_LAYOUT_UNUSED_FRAME_MAX) != 0)
+			return;
+
+		for (auto it = m_layouts.begin(); it != m_layouts.end();)
+		{
+			if ((m_frame - it->second.LastUsedFrame) > STRING_LAYOUT_UNUSED_FRAME_MAX)
+				it = m_layouts.erase(it);
+			else
+				it++;
+		}
+	}
+
+	void StringLayoutCache::Clear()
+	{
+		m_layouts.clear();
+		m_frame = 0;
+	}
+
+	// Prints typical HUD frame of static labels and changing counters for one minute, once by laying out every print
+	// as before caching and once through cache. Font metrics are stubbed, so only CPU side of printing is measured.
+	// Checks cached layouts match fresh ones, static layouts are built once and kept, and counters don't grow cache.
+	bool BenchmarkStringLayouts()
+	{
+		constexpr auto FRAME_COUNT	 = 3600;
+		constexpr auto COUNTER_COUNT = 4;
+		constexpr auto LINE_HEIGHT	 = 24.0f;
+
+		const auto staticStrings = std::vector<std::string>
+		{
+			"Health", "Air", "Sprint", "Ammo", "Small Medipack", "Large Medipack", "Flares",
+			"Pistols", "Shotgun", "Uzis", "Revolver", "Examine", "Combine", "Separate",
+			"Use\nCombine\nSeparate", "Load Game", "Save Game", "Options", "Exit to Title",
+			"You found a secret!\nSecrets found: 1 of 36"
+		};
+
+		// Stubbed font adds up per glyph advances, as real font walks glyphs of string.
+		int measureCount = 0;
+		auto measure = [&](const std::wstring& string)
+		{
+			measureCount++;
+
+			float width = 0.0f;
+			for (auto glyph : string)
+				width += 8.0f + (glyph % 8);
+
+			return Vector2(width, LINE_HEIGHT);
+		};
+
+		// Counter I changes every 4^I frames, from timer to rarely changing score.
+		auto frames = std::vector<std::vector<std::string>>(FRAME_COUNT, staticStrings);
+		auto counterStrings = std::vector<std::string>{};
+		for (int i = 0; i < FRAME_COUNT; i++)
+		{
+			for (int j = 0; j < COUNTER_COUNT; j++)
+			{
+				auto string = "Counter " + std::to_string(j) + ": " + std::to_string(i >> (j * 2));
+				if (i == 0 || string != frames[i - 1][staticStrings.size() + j])
+					counterStrings.push_back(string);
+
+				frames[i].push_back(string);
+			}
+		}
+
+		int staticLineCount = 0;
+		for (const auto& string : staticStrings)
+			staticLineCount += (int)TEN::Utils::SplitString(string).size();
+
+		bool isPassed = true;
+		auto check = [&](bool condition, const std::string& message)
+		{
+			if (!condition)
+			{
+				TENLog("String layouts: " + message, LogLevel::Error);
+				isPassed = false;
+			}
+		};
+
+		// Lay out every print.
+		float uncachedChecksum = 0.0f;
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (const auto& strings : frames)
+		{
+			for (const auto& string : strings)
+			{
+				for (const auto& line : CreateStringLayout(string, measure).Lines)
+					uncachedChecksum += line.Size.x + line.Size.y;
+			}
+		}
+		auto uncachedTime = std::chrono::high_resolution_clock::now() - startTime;
+		int uncachedMeasureCount = measureCount;
+
+		// Look up prints in cache.
+		auto cache = StringLayoutCache();
+		auto staticLayouts = std::vector<const RendererStringLayout*>{};
+		int layoutCountMax = 0;
+		float cachedChecksum = 0.0f;
+		measureCount = 0;
+
+		startTime = std::chrono::high_resolution_clock::now();
+		for (const auto& strings : frames)
+		{
+			for (const auto& string : strings)
+			{
+				for (const auto& line : cache.Get(string, measure).Lines)
+					cachedChecksum += line.Size.x + line.Size.y;
+			}
+
+			layoutCountMax = std::max(layoutCountMax, cache.GetCount());
+			cache.EndFrame();
+		}
+		auto cachedTime = std::chrono::high_resolution_clock::now() - startTime;
+		int cachedMeasureCount = measureCount;
+
+		check(cachedChecksum == uncachedChecksum, "Cached layouts measure differently from fresh ones.");
+		check(cachedMeasureCount == (staticLineCount + counterStrings.size()), "Layouts were rebuilt while still printed.");
+		check(layoutCountMax <= (staticStrings.size() + (COUNTER_COUNT * ((STRING_LAYOUT_UNUSED_FRAME_MAX * 2) + 1))), "Changing counters grew cache without bound.");
+
+		// Static layouts survive eviction and match fresh layout line by line.
+		for (const auto& string : staticStrings)
+		{
+			const auto& layout = cache.Get(string, measure);
+			auto freshLayout = CreateStringLayout(string, measure);
+
+			check(layout.Lines.size() == freshLayout.Lines.size(), "Layout of '" + string + "' has wrong line count.");
+			for (int i = 0; i < std::min(layout.Lines.size(), freshLayout.Lines.size()); i++)
+			{
+				check(layout.Lines[i].String == freshLayout.Lines[i].String && layout.Lines[i].Size == freshLayout.Lines[i].Size,
+					  "Layout of '" + string + "' differs from fresh layout.");
+			}
+		}
+
+		// Layouts no longer printed are all evicted.
+		for (int i = 0; i < ((STRING_LAYOUT_UNUSED_FRAME_MAX * 2) + 1); i++)
+			cache.EndFrame();
+
+		check(cache.GetCount() == 0, "Unprinted layouts weren't evicted.");
+
+		auto getFrameTime = [](auto time) { return std::to_string(std::chrono::duration<double, std::micro>(time).count() / FRAME_COUNT); };
+		TENLog("String layouts: " + std::to_string(frames.front().size()) + " prints per frame take " +
+			   getFrameTime(uncachedTime) + " us uncached (" + std::to_string(uncachedMeasureCount) + " measures) and " +
+			   getFrameTime(cachedTime) + " us cached (" + std::to_string(cachedMeasureCount) + " measures, " +
+			   std::to_string(layoutCountMax) + " layouts at most).", LogLevel::Info);
+
+		return isPassed;
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <SimpleMath.h>
+
+#include "Renderer/Structures/RendererStringLayout.h"
+
+namespace TEN::Renderer
+{
+	// Retained split and measured layouts of printed strings, keyed by string content.
+	// Measuring is supplied by caller, so cache itself doesn't depend on font or device.
+	class StringLayoutCache
+	{
+	public:
+		using MeasureFunction = std::function<Vector2(const std::wstring& string)>;
+
+		StringLayoutCache() = default;
+
+		int							GetCount() const;
+		const RendererStringLayout& Get(const std::string& string, const MeasureFunction& measure);
+
+		void EndFrame();
+		void Clear();
+
+	private:
+		std::unordered_map<std::string, RendererStringLayout> m_layouts = {};
+		int													  m_frame	= 0;
+	};
+
+	bool BenchmarkStringLayouts();
+}
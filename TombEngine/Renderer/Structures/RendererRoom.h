@@ -13,11 +13,9 @@ namespace TEN::Renderer
 	struct RendererLight;
 	struct RendererEffect;
 	struct RendererTransparentFace;
-	struct RendererDoor;
 
 	struct RendererRoom
 	{
-		bool Visited;
 		short RoomNumber;
 		Vector4 AmbientLight;
 		Vector4 ViewPort;
@@ -29,7 +27,6 @@ namespace TEN::Renderer
 		std::vector<RendererStatic*> StaticsToDraw;
 		std::vector<RendererTransparentFace> TransparentFacesToDraw;
 		std::vector<RendererLight*> LightsToDraw;
-		std::vector<RendererDoor> Doors;
 		BoundingBox BoundingBox;
 		RendererRectangle ClipBounds;
 		std::vector<int> Neighbors;
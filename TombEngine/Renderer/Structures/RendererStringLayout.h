@@ -0,0 +1,18 @@
+#pragma once
+#include <SimpleMath.h>
+
+namespace TEN::Renderer
+{
+	struct RendererStringLine
+	{
+		std::wstring String;
+		Vector2 Size; // Unscaled.
+	};
+
+	// Split and measured string, kept between frames while it is being printed.
+	struct RendererStringLayout
+	{
+		std::vector<RendererStringLine> Lines;
+		int LastUsedFrame;
+	};
+}
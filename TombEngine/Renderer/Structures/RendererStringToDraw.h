@@ -8,7 +8,7 @@ namespace TEN::Renderer
 		float X;
 		float Y;
 		int Flags;
-		std::wstring String;
+		const std::wstring* String; // Points into string layout cache, valid until strings are drawn.
 		Vector3 Color;
 		float Scale;
 	};
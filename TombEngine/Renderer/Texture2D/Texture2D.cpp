@@ -93,4 +93,43 @@ namespace TEN::Renderer
 		Width = desc.Width;
 		Height = desc.Height;
 	}
+
+	// Uploads texture decoded on CPU, including its prebuilt mip chain.
+	Texture2D::Texture2D(ID3D11Device* device, const TextureData& data)
+	{
+		Width = data.Width;
+		Height = data.Height;
+
+		int mipCount = data.GetMipCount();
+
+		D3D11_TEXTURE2D_DESC desc = {};
+		desc.Width = Width;
+		desc.Height = Height;
+		desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.CPUAccessFlags = 0;
+		desc.MiscFlags = 0;
+		desc.MipLevels = mipCount;
+		desc.ArraySize = 1;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		desc.SampleDesc.Count = 1;
+		desc.SampleDesc.Quality = 0;
+		desc.Usage = D3D11_USAGE_IMMUTABLE;
+
+		auto subresourceData = std::vector<D3D11_SUBRESOURCE_DATA>(mipCount);
+		for (int i = 0; i < mipCount; i++)
+		{
+			subresourceData[i].pSysMem = &data.Pixels[data.MipOffsets[i]];
+			subresourceData[i].SysMemPitch = data.GetMipWidth(i) * 4;
+			subresourceData[i].SysMemSlicePitch = 0;
+		}
+
+		throwIfFailed(device->CreateTexture2D(&desc, subresourceData.data(), &Texture));
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC shaderDesc = {};
+		shaderDesc.Format = desc.Format;
+		shaderDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+		shaderDesc.Texture2D.MostDetailedMip = 0;
+		shaderDesc.Texture2D.MipLevels = mipCount;
+		throwIfFailed(device->CreateShaderResourceView(Texture.Get(), &shaderDesc, ShaderResourceView.GetAddressOf()));
+	}
 }
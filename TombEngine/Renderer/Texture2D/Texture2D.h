@@ -3,6 +3,7 @@
 #include <string>
 #include <wrl/client.h>
 #include "Renderer/TextureBase.h"
+#include "Renderer/Texture2D/TextureData.h"
 
 namespace TEN::Renderer 
 {
@@ -22,6 +23,7 @@ namespace TEN::Renderer
 		~Texture2D() = default;
 
 		Texture2D(ID3D11Device* device, byte* data, int length);
+		Texture2D(ID3D11Device* device, const TextureData& data);
 	};
 
 }
@@ -0,0 +1,339 @@
+#include "framework.h"
+#include "Renderer/Texture2D/TextureData.h"
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+#pragma comment(lib, "windowscodecs.lib")
+
+using Microsoft::WRL::ComPtr;
+
+namespace TEN::Renderer
+{
+	constexpr auto TEXTURE_PIXEL_SIZE = 4;
+
+	int TextureData::GetMipCount() const
+	{
+		return (int)MipOffsets.size();
+	}
+
+	int TextureData::GetMipWidth(int level) const
+	{
+		return std::max(Width >> level, 1);
+	}
+
+	int TextureData::GetMipHeight(int level) const
+	{
+		return std::max(Height >> level, 1);
+	}
+
+	bool TextureData::IsValid() const
+	{
+		return (Width > 0 && Height > 0 && !MipOffsets.empty());
+	}
+
+	bool IsDDSTexture(const TextureSource& source)
+	{
+		return (source.Length >= 3 && source.Data[0] == 'D' && source.Data[1] == 'D' && source.Data[2] == 'S');
+	}
+
+	// Decodes PNG and other WIC-supported formats to RGBA8. DDS textures are not handled here,
+	// as they already carry their own format and mips and are uploaded by device as is.
+	bool DecodeTexture(const TextureSource& source, TextureData& texture)
+	{
+		texture = TextureData{};
+
+		if (source.Data == nullptr || source.Length <= 0 || IsDDSTexture(source))
+			return false;
+
+		ComPtr<IWICImagingFactory> factory;
+		if (FAILED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.GetAddressOf()))))
+			return false;
+
+		ComPtr<IWICStream> stream;
+		if (FAILED(factory->CreateStream(stream.GetAddressOf())) ||
+			FAILED(stream->InitializeFromMemory(const_cast<byte*>(source.Data), (DWORD)source.Length)))
+		{
+			return false;
+		}
+
+		ComPtr<IWICBitmapDecoder> decoder;
+		if (FAILED(factory->CreateDecoderFromStream(stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, decoder.GetAddressOf())))
+			return false;
+
+		ComPtr<IWICBitmapFrameDecode> frame;
+		if (FAILED(decoder->GetFrame(0, frame.GetAddressOf())))
+			return false;
+
+		UINT width = 0;
+		UINT height = 0;
+		if (FAILED(frame->GetSize(&width, &height)) || width == 0 || height == 0)
+			return false;
+
+		ComPtr<IWICFormatConverter> converter;
+		if (FAILED(factory->CreateFormatConverter(converter.GetAddressOf())) ||
+			FAILED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom)))
+		{
+			return false;
+		}
+
+		UINT stride = width * TEXTURE_PIXEL_SIZE;
+		auto pixels = std::vector<byte>(stride * height);
+		if (FAILED(converter->CopyPixels(nullptr, stride, (UINT)pixels.size(), pixels.data())))
+			return false;
+
+		texture.Width = (int)width;
+		texture.Height = (int)height;
+		texture.Pixels = std::move(pixels);
+		texture.MipOffsets = { 0 };
+		return true;
+	}
+
+	// Builds remaining mip levels with 2x2 box filter. Odd edges are clamped.
+	void GenerateMipChain(TextureData& texture)
+	{
+		if (!texture.IsValid())
+			return;
+
+		int mipCount = 1;
+		for (int size = std::max(texture.Width, texture.Height); size > 1; size >>= 1)
+			mipCount++;
+
+		size_t totalSize = 0;
+		auto offsets = std::vector<int>(mipCount);
+		for (int level = 0; level < mipCount; level++)
+		{
+			offsets[level] = (int)totalSize;
+			totalSize += (size_t)texture.GetMipWidth(level) * texture.GetMipHeight(level) * TEXTURE_PIXEL_SIZE;
+		}
+
+		texture.Pixels.resize(totalSize);
+		texture.MipOffsets = std::move(offsets);
+
+		for (int level = 1; level < mipCount; level++)
+		{
+			int srcWidth = texture.GetMipWidth(level - 1);
+			int srcHeight = texture.GetMipHeight(level - 1);
+			int dstWidth = texture.GetMipWidth(level);
+			int dstHeight = texture.GetMipHeight(level);
+
+			const byte* src = &texture.Pixels[texture.MipOffsets[level - 1]];
+			byte* dst = &texture.Pixels[texture.MipOffsets[level]];
+
+			for (int y = 0; y < dstHeight; y++)
+			{
+				int y0 = std::min(y * 2, srcHeight - 1);
+				int y1 = std::min((y * 2) + 1, srcHeight - 1);
+
+				for (int x = 0; x < dstWidth; x++)
+				{
+					int x0 = std::min(x * 2, srcWidth - 1);
+					int x1 = std::min((x * 2) + 1, srcWidth - 1);
+
+					const byte* p00 = &src[((y0 * srcWidth) + x0) * TEXTURE_PIXEL_SIZE];
+					const byte* p01 = &src[((y0 * srcWidth) + x1) * TEXTURE_PIXEL_SIZE];
+					const byte* p10 = &src[((y1 * srcWidth) + x0) * TEXTURE_PIXEL_SIZE];
+					const byte* p11 = &src[((y1 * srcWidth) + x1) * TEXTURE_PIXEL_SIZE];
+
+					byte* out = &dst[((y * dstWidth) + x) * TEXTURE_PIXEL_SIZE];
+					for (int c = 0; c < TEXTURE_PIXEL_SIZE; c++)
+						out[c] = (byte)((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+				}
+			}
+		}
+	}
+
+	static size_t GetTextureHash(const TextureData& texture)
+	{
+		auto pixels = std::string_view((const char*)texture.Pixels.data(), texture.Pixels.size());
+		return ((std::hash<std::string_view>{}(pixels) * 31) + ((size_t)texture.Width << 16) + texture.Height);
+	}
+
+	// Decodes sources through queue and then on single thread, checks that both produce same textures
+	// and logs time taken by each.
+	bool BenchmarkTextureDecodeQueue(const std::vector<TextureSource>& sources, int capacity)
+	{
+		HRESULT comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		// Only hashes are kept, so that benchmark doesn't hold all decoded textures in memory at once.
+		auto queueHashes = std::vector<size_t>(sources.size(), 0);
+		auto isTaken = std::vector<bool>(sources.size(), false);
+		bool isPassed = true;
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		{
+			auto queue = TextureDecodeQueue(sources, capacity);
+
+			int index = 0;
+			auto texture = TextureData{};
+			while (queue.TakeNext(index, texture))
+			{
+				if (isTaken[index])
+					isPassed = false;
+
+				isTaken[index] = true;
+				queueHashes[index] = GetTextureHash(texture);
+			}
+
+			queue.Finish();
+		}
+		auto queueTime = std::chrono::high_resolution_clock::now() - startTime;
+
+		startTime = std::chrono::high_resolution_clock::now();
+		int mismatchCount = 0;
+		for (int i = 0; i < sources.size(); i++)
+		{
+			auto texture = TextureData{};
+			if (DecodeTexture(sources[i], texture))
+				GenerateMipChain(texture);
+
+			if (!isTaken[i] || queueHashes[i] != GetTextureHash(texture))
+				mismatchCount++;
+		}
+		auto singleTime = std::chrono::high_resolution_clock::now() - startTime;
+
+		if (SUCCEEDED(comResult))
+			CoUninitialize();
+
+		using ms = std::chrono::duration<double, std::milli>;
+		TENLog("Decoded " + std::to_string(sources.size()) + " textures: queue " + std::to_string(ms(queueTime).count()) +
+			   " ms, single thread " + std::to_string(ms(singleTime).count()) + " ms, " + std::to_string(mismatchCount) + " mismatches.", LogLevel::Info);
+
+		return (isPassed && mismatchCount == 0);
+	}
+
+	TextureDecodeQueue::TextureDecodeQueue(const std::vector<TextureSource>& sources, int capacity) :
+		m_sources(sources)
+	{
+		m_capacity = std::max(capacity, 1);
+		m_decoded.reserve(m_capacity);
+
+		if (sources.empty())
+			return;
+
+		int workerCount = std::clamp((int)std::thread::hardware_concurrency(), 1, std::min((int)sources.size(), m_capacity));
+		for (int i = 0; i < workerCount; i++)
+			m_workers.push_back(std::async(std::launch::async, &TextureDecodeQueue::DecodeJob, this));
+	}
+
+	TextureDecodeQueue::~TextureDecodeQueue()
+	{
+		{
+			auto lock = std::lock_guard<std::mutex>(m_mutex);
+			m_isCancelled = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			if (worker.valid())
+				worker.wait();
+		}
+	}
+
+	// Blocks until any source is decoded and returns it with its index. Returns false once all sources were taken.
+	// Failed or DDS entries are returned invalid. Rethrows exception of failed worker, e.g. if it ran out of memory.
+	bool TextureDecodeQueue::TakeNext(int& index, TextureData& texture)
+	{
+		auto lock = std::unique_lock<std::mutex>(m_mutex);
+		m_condition.wait(lock, [&]() { return (!m_decoded.empty() || m_isFailed || m_takenCount >= (int)m_sources.size()); });
+
+		if (m_takenCount >= (int)m_sources.size())
+			return false;
+
+		if (m_decoded.empty())
+		{
+			lock.unlock();
+			Finish();
+			throw std::runtime_error("Texture decoding worker failed.");
+		}
+
+		index = m_decoded.back().first;
+		texture = std::move(m_decoded.back().second);
+		m_decoded.pop_back();
+		m_pendingCount--;
+		m_takenCount++;
+		lock.unlock();
+
+		// Free slot for next source.
+		m_condition.notify_all();
+		return true;
+	}
+
+	// Stops workers and reports first exception thrown by any of them.
+	void TextureDecodeQueue::Finish()
+	{
+		{
+			auto lock = std::lock_guard<std::mutex>(m_mutex);
+			m_isCancelled = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			if (worker.valid())
+				worker.get();
+		}
+	}
+
+	void TextureDecodeQueue::DecodeJob()
+	{
+		// WIC is COM-based, so each worker needs its own COM apartment.
+		HRESULT comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+		try
+		{
+			while (true)
+			{
+				int index = 0;
+				{
+					auto lock = std::unique_lock<std::mutex>(m_mutex);
+					m_condition.wait(lock, [this]()
+					{
+						return (m_isCancelled || m_isFailed || m_nextIndex >= (int)m_sources.size() ||
+								m_pendingCount < m_capacity);
+					});
+
+					if (m_isCancelled || m_isFailed || m_nextIndex >= (int)m_sources.size())
+						break;
+
+					index = m_nextIndex++;
+					m_pendingCount++;
+				}
+
+				auto texture = TextureData{};
+				if (DecodeTexture(m_sources[index], texture))
+					GenerateMipChain(texture);
+
+				{
+					auto lock = std::lock_guard<std::mutex>(m_mutex);
+					m_decoded.push_back(std::pair(index, std::move(texture)));
+				}
+
+				m_condition.notify_all();
+			}
+		}
+		catch (...)
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(m_mutex);
+				m_isFailed = true;
+			}
+
+			m_condition.notify_all();
+
+			if (SUCCEEDED(comResult))
+				CoUninitialize();
+
+			throw;
+		}
+
+		if (SUCCEEDED(comResult))
+			CoUninitialize();
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace TEN::Renderer
+{
+	constexpr auto TEXTURE_DECODE_QUEUE_SIZE = 8; // Max. textures decoding or waiting for upload at once.
+
+	// Encoded image bytes as stored in level file.
+	struct TextureSource
+	{
+		const byte* Data   = nullptr;
+		int			Length = 0;
+	};
+
+	// Decoded RGBA8 image with full mip chain, ready for upload. Doesn't depend on graphics device.
+	struct TextureData
+	{
+		int Width  = 0;
+		int Height = 0;
+
+		std::vector<byte> Pixels	 = {}; // All mip levels packed tightly, largest first.
+		std::vector<int>  MipOffsets = {}; // Offset of each mip level in Pixels.
+
+		int  GetMipCount() const;
+		int  GetMipWidth(int level) const;
+		int  GetMipHeight(int level) const;
+		bool IsValid() const;
+	};
+
+	bool IsDDSTexture(const TextureSource& source);
+	bool DecodeTexture(const TextureSource& source, TextureData& texture);
+	void GenerateMipChain(TextureData& texture);
+
+	bool BenchmarkTextureDecodeQueue(const std::vector<TextureSource>& sources, int capacity);
+
+	// Decodes and mips sources on worker threads ahead of device. At most capacity textures are decoding
+	// or waiting to be taken at once. Textures are taken in order they finish, so single slow texture
+	// doesn't hold up others and queue can't stall regardless of capacity.
+	class TextureDecodeQueue
+	{
+	private:
+		const std::vector<TextureSource>& m_sources;
+
+		std::vector<std::pair<int, TextureData>> m_decoded		= {}; // Finished textures waiting to be taken, with source index.
+		int										 m_capacity		= 0;
+		int										 m_nextIndex	= 0; // Next source to be claimed by worker.
+		int										 m_pendingCount = 0; // Claimed by workers but not yet taken.
+		int										 m_takenCount	= 0;
+		bool									 m_isFailed		= false;
+		bool									 m_isCancelled	= false;
+
+		std::mutex					   m_mutex	   = {};
+		std::condition_variable		   m_condition = {};
+		std::vector<std::future<void>> m_workers   = {};
+
+	public:
+		TextureDecodeQueue(const std::vector<TextureSource>& sources, int capacity);
+		~TextureDecodeQueue();
+
+		bool TakeNext(int& index, TextureData& texture);
+		void Finish();
+
+	private:
+		void DecodeJob();
+	};
+}
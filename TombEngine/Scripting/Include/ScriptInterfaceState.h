@@ -12,4 +12,5 @@ public:
 	static ScriptInterfaceObjectsHandler* CreateObjectsHandler();
 	static ScriptInterfaceStringsHandler* CreateStringsHandler();
 	static void ScriptInterfaceState::Init(const std::string& assetsDir);
+	static size_t GetMemoryUsage();
 };
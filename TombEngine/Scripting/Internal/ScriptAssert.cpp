@@ -3,18 +3,18 @@
 
 static ErrorMode ScriptErrorMode = ErrorMode::Warn;
 
-void ScriptWarn(const std::string& msg)
+void ScriptWarn(const std::string& msg, const char* file, int line)
 {
 	switch (ScriptErrorMode)
 	{
 	case ErrorMode::Terminate:
 	case ErrorMode::Warn:
-		TENLog(msg, LogLevel::Warning, LogConfig::All);
+		TENLog(msg, LogLevel::Warning, LogConfig::All, false, file, line);
 		break;
 	}
 }
 
-bool ScriptAssert(bool cond, const std::string& msg, std::optional<ErrorMode> forceMode)
+bool ScriptAssert(bool cond, const std::string& msg, std::optional<ErrorMode> forceMode, const char* file, int line)
 {
 	if (!cond)
 	{
@@ -22,11 +22,11 @@ bool ScriptAssert(bool cond, const std::string& msg, std::optional<ErrorMode> fo
 		switch (mode)
 		{
 		case ErrorMode::Warn:
-			TENLog(msg, LogLevel::Error, LogConfig::All);
+			TENLog(msg, LogLevel::Error, LogConfig::All, false, file, line);
 			break;
 
 		case ErrorMode::Terminate:
-			TENLog(msg, LogLevel::Error, LogConfig::All);
+			TENLog(msg, LogLevel::Error, LogConfig::All, false, file, line);
 			throw TENScriptException(msg);
 			break;
 		}
@@ -13,23 +13,40 @@ enum class ErrorMode
 void SetScriptErrorMode(ErrorMode mode);
 ErrorMode GetScriptErrorMode();
 
-void ScriptWarn(const std::string& msg);
+// Caller's site is forwarded to TENLog, so repeats are limited per calling site rather than for all script errors at once.
+void ScriptWarn(const std::string& msg, const char* file = __builtin_FILE(), int line = __builtin_LINE());
 
-bool ScriptAssert(bool cond, const std::string& msg, std::optional<ErrorMode> forceMode = std::nullopt);
+bool ScriptAssert(bool cond, const std::string& msg, std::optional<ErrorMode> forceMode = std::nullopt,
+				  const char* file = __builtin_FILE(), int line = __builtin_LINE());
 
-template <typename ... Ts> bool ScriptAssertF(bool cond, std::string_view str, Ts...args)
+// Format string which also records caller's site, since variadic templates can't take trailing default arguments.
+struct ScriptFormatString
+{
+	std::string_view String = {};
+	const char*		 File	= nullptr;
+	int				 Line	= 0;
+
+	ScriptFormatString(const char* str, const char* file = __builtin_FILE(), int line = __builtin_LINE()) :
+		String(str), File(file), Line(line) {}
+	ScriptFormatString(std::string_view str, const char* file = __builtin_FILE(), int line = __builtin_LINE()) :
+		String(str), File(file), Line(line) {}
+	ScriptFormatString(const std::string& str, const char* file = __builtin_FILE(), int line = __builtin_LINE()) :
+		String(str), File(file), Line(line) {}
+};
+
+template <typename ... Ts> bool ScriptAssertF(bool cond, ScriptFormatString str, Ts...args)
 {
 	if (!cond)
 	{
-		auto msg = fmt::format(str, args...);
+		auto msg = fmt::format(str.String, args...);
 		switch (GetScriptErrorMode())
 		{
 		case ErrorMode::Warn:
-			TENLog(msg, LogLevel::Error, LogConfig::All);
+			TENLog(msg, LogLevel::Error, LogConfig::All, false, str.File, str.Line);
 			break;
 
 		case ErrorMode::Terminate:
-			TENLog(msg, LogLevel::Error, LogConfig::All);
+			TENLog(msg, LogLevel::Error, LogConfig::All, false, str.File, str.Line);
 			throw TENScriptException(msg);
 		}
 	}
@@ -37,12 +54,12 @@ template <typename ... Ts> bool ScriptAssertF(bool cond, std::string_view str, T
 	return cond;
 }
 
-template <typename ... Ts> bool ScriptAssertTerminateF(bool cond, std::string_view str, Ts...args)
+template <typename ... Ts> bool ScriptAssertTerminateF(bool cond, ScriptFormatString str, Ts...args)
 {
 	if (!cond)
 	{
-		auto msg = fmt::format(str, args...);
-		TENLog(msg, LogLevel::Error, LogConfig::All);
+		auto msg = fmt::format(str.String, args...);
+		TENLog(msg, LogLevel::Error, LogConfig::All, false, str.File, str.Line);
 		throw TENScriptException(msg);
 	}
 
@@ -53,3 +53,8 @@ void ScriptInterfaceState::Init(const std::string& assetsDir)
 	Misc::Register(&s_solState, s_rootTable);
 	Effects::Register(&s_solState, s_rootTable);
 }
+
+size_t ScriptInterfaceState::GetMemoryUsage()
+{
+	return s_solState.memory_used();
+}
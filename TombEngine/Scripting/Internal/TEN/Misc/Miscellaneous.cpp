@@ -390,9 +390,14 @@ namespace Misc
 	//-- spammed message
 	//PrintLog('test spam log', LogLevel.INFO, true)
 	// 
-	static void PrintLog(const std::string& message, const LogLevel& level, TypeOrNil<bool> allowSpam)
+	static void PrintLog(sol::this_state state, const std::string& message, const LogLevel& level, TypeOrNil<bool> allowSpam)
 	{
-		TENLog(message, level, LogConfig::All, USE_IF_HAVE(bool, allowSpam, false));
+		// Repeats are limited per calling script line, not per this function.
+		auto info = lua_Debug{};
+		if (lua_getstack(state, 1, &info) && lua_getinfo(state, "Sl", &info))
+			TENLog(message, level, LogConfig::All, USE_IF_HAVE(bool, allowSpam, false), info.source, info.currentline);
+		else
+			TENLog(message, level, LogConfig::All, USE_IF_HAVE(bool, allowSpam, false));
 	}
 
 	void Register(sol::state* state, sol::table& parent)
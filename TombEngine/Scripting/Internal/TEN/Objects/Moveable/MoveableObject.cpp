@@ -39,15 +39,21 @@ static auto index_error = index_error_maker(Moveable, LUA_CLASS_NAME);
 static auto newindex_error = newindex_error_maker(Moveable, LUA_CLASS_NAME);
 
 
-Moveable::Moveable(short num, bool alreadyInitialized) : m_item{ &g_Level.Items[num] }, m_num{ num }, m_initialized{ alreadyInitialized }
-{
-	if (alreadyInitialized)
+// Item number may be NO_ITEM if item couldn't be created, in which case handle is invalid.
+Moveable::Moveable(short num, bool alreadyInitialized) :
+	m_item{ (num != NO_ITEM) ? &g_Level.Items[num] : nullptr },
+	m_num{ num },
+	m_generation{ (num != NO_ITEM) ? g_Level.Items[num].Generation : 0 },
+	m_initialized{ alreadyInitialized }
+{
+	if (alreadyInitialized && m_item != nullptr)
 		dynamic_cast<ObjectsHandler*>(g_GameScriptEntities)->AddMoveableToMap(m_item, this);
 };
 
 Moveable::Moveable(Moveable&& other) noexcept : 
 	m_item{ std::exchange(other.m_item, nullptr) },
 	m_num{ std::exchange(other.m_num, NO_ITEM) },
+	m_generation{ other.m_generation },
 	m_initialized{ std::exchange(other.m_initialized, false) }
 {
 	if (GetValid())
@@ -104,6 +110,9 @@ static std::unique_ptr<Moveable> Create(
 )
 {
 	short num = CreateItem();
+	if (!ScriptAssert(num != NO_ITEM, "Could not create Moveable; item limit reached. Returning nil."))
+		return nullptr;
+
 	auto ptr = std::make_unique<Moveable>(num, false);
 
 	if (ScriptAssert(ptr->SetName(name), "Could not set name for Moveable; returning an invalid object."))
@@ -1149,12 +1158,13 @@ void Moveable::Invalidate()
 
 bool Moveable::GetValid() const
 {
-	return m_num > NO_ITEM;
+	// Slot may have been freed and reused by another item since this handle was created.
+	return (m_num > NO_ITEM && IsItemHandleValid(ItemHandle{ m_num, m_generation }));
 }
 
 void Moveable::Destroy()
 {
-	if (m_num > NO_ITEM) 
+	if (GetValid()) 
 	{
 		dynamic_cast<ObjectsHandler*>(g_GameScriptEntities)->RemoveMoveableFromMap(m_item, this);
 		s_callbackRemoveName(m_item->Name);
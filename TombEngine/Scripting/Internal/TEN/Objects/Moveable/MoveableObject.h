@@ -137,6 +137,7 @@ protected:
 
 private:
 	short m_num;
+	unsigned int m_generation;
 	bool m_initialized;
 
 	bool MeshExists(int number) const;
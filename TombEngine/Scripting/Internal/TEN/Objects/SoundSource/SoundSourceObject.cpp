@@ -67,6 +67,7 @@ Vec3 SoundSource::GetPos() const
 void SoundSource::SetPos(Vec3 const& pos)
 {
 	m_soundSource.Position = Vector3i(pos.x, pos.y, pos.z);
+	InvalidateSoundSources();
 }
 
 std::string SoundSource::GetName() const
@@ -102,4 +103,5 @@ int SoundSource::GetSoundID() const
 void SoundSource::SetSoundID(int soundID)
 {	
 	m_soundSource.SoundID = soundID;
+	InvalidateSoundSources();
 }
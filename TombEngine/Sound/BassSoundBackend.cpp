@@ -0,0 +1,196 @@
+#include "framework.h"
+#include "Sound/BassSoundBackend.h"
+
+#include "Sound/sound.h"
+
+namespace TEN::Sound
+{
+	const BASS_BFX_FREEVERB BASS_ReverbTypes[(int)ReverbType::Count] =    // Reverb presets
+
+	{ // Dry Mix | Wet Mix |  Size   |  Damp   |  Width  |  Mode  | Channel
+	  {  1.0f,     0.20f,     0.05f,    0.90f,    0.7f,     0,      -1     },	// 0 = Outside
+	  {  1.0f,     0.20f,     0.35f,    0.15f,    0.8f,     0,      -1     },	// 1 = Small room
+	  {  1.0f,     0.25f,     0.55f,    0.20f,    1.0f,     0,      -1     },	// 2 = Medium room
+	  {  1.0f,     0.25f,     0.80f,    0.50f,    1.0f,     0,      -1     },	// 3 = Large room
+	  {  1.0f,     0.25f,     0.90f,    1.00f,    1.0f,     0,      -1     }	// 4 = Pipe
+	};
+
+	// Expects BASS device to be already initialized.
+	bool BassSoundBackend::Initialize(int sampleCount, int channelCount)
+	{
+		m_samples.assign(sampleCount, NULL);
+		m_channels.assign(channelCount, NULL);
+
+		// Set 3D world parameters.
+		// Rolloff is lessened since we have own attenuation implementation.
+		BASS_Set3DFactors(SOUND_BASS_UNITS, 1.5f, 0.5f);
+		BASS_SetConfig(BASS_CONFIG_3DALGORITHM, BASS_3DALG_FULL);
+
+		// Set minimum latency and 2 threads for updating.
+		// Most of modern PCs already have multi-core CPUs, so why not parallelize updating?
+		BASS_SetConfig(BASS_CONFIG_UPDATETHREADS, 2);
+		BASS_SetConfig(BASS_CONFIG_UPDATEPERIOD, 10);
+
+		// Create 3D mixdown channel and make it play forever.
+		// For realtime mixer channels, we need minimum buffer latency. It shouldn't affect reliability.
+		BASS_SetConfig(BASS_CONFIG_BUFFER, 40);
+		m_mixdown = BASS_StreamCreate(44100, 2, BASS_SAMPLE_FLOAT, STREAMPROC_DEVICE_3D, NULL);
+		BASS_ChannelPlay(m_mixdown, false);
+
+		// Reset buffer back to normal value.
+		BASS_SetConfig(BASS_CONFIG_BUFFER, 300);
+
+		if (Sound_CheckBASSError("Starting 3D mixdown", true))
+			return false;
+
+		// Attach reverb effect to 3D channel
+		m_reverb = BASS_ChannelSetFX(m_mixdown, BASS_FX_BFX_FREEVERB, 0);
+		BASS_FXSetParameters(m_reverb, &BASS_ReverbTypes[(int)ReverbType::Outside]);
+
+		if (Sound_CheckBASSError("Attaching environmental FX", true))
+			return false;
+
+		// Apply slight compression to 3D channel
+		m_compressor = BASS_ChannelSetFX(m_mixdown, BASS_FX_BFX_COMPRESSOR2, 1);
+		auto comp = BASS_BFX_COMPRESSOR2{ 4.0f, -18.0f, 1.5f, 10.0f, 100.0f, -1 };
+		BASS_FXSetParameters(m_compressor, &comp);
+
+		if (Sound_CheckBASSError("Attaching compressor", true))
+			return false;
+
+		return true;
+	}
+
+	bool BassSoundBackend::LoadSample(int sampleIndex, const float* data, int sampleCount, int frequency)
+	{
+		// Paranoid (c) TeslaRus
+		// Try to free sample before allocating new one.
+		FreeSample(sampleIndex);
+
+		HSAMPLE sample = BASS_SampleCreate(sampleCount * sizeof(float), frequency, 1, 65535, SOUND_SAMPLE_FLAGS | BASS_SAMPLE_3D);
+		if (Sound_CheckBASSError("Creating sample %d", false, sampleIndex))
+			return false;
+
+		BASS_SampleSetData(sample, data);
+		m_samples[sampleIndex] = sample;
+		return true;
+	}
+
+	void BassSoundBackend::FreeSample(int sampleIndex)
+	{
+		if (m_samples[sampleIndex] != NULL)
+		{
+			BASS_SampleFree(m_samples[sampleIndex]);
+			m_samples[sampleIndex] = NULL;
+		}
+	}
+
+	bool BassSoundBackend::StartChannel(int channel, const SoundChannelParams& params)
+	{
+		// Create sample's stream and reset buffer back to normal value.
+		HCHANNEL handle = BASS_SampleGetChannel(m_samples[params.SampleIndex], true);
+
+		if (Sound_CheckBASSError("Trying to create channel for sample %d", false, params.SampleIndex))
+			return false;
+
+		m_channels[channel] = handle;
+
+		// Set looped flag, if necessary
+		if (params.IsLooped)
+			BASS_ChannelFlags(handle, BASS_SAMPLE_LOOP, BASS_SAMPLE_LOOP);
+
+		if (params.StartTime > 0.0f)
+			BASS_ChannelSetPosition(handle, BASS_ChannelSeconds2Bytes(handle, params.StartTime), BASS_POS_BYTE);
+
+		// Play channel
+		BASS_ChannelPlay(handle, false);
+
+		if (Sound_CheckBASSError("Queuing channel %x on sample mixer", false, channel))
+		{
+			StopChannel(channel, 0);
+			return false;
+		}
+
+		// Set attributes
+		BASS_ChannelSet3DAttributes(handle, params.Is3D ? BASS_3DMODE_NORMAL : BASS_3DMODE_OFF, params.MinDistance, params.MaxDistance, 360, 360, 0.0f);
+		if (params.Is3D)
+			SetChannelPosition(channel, params.Position);
+
+		SetChannelAttributes(channel, params.Pitch, params.Gain);
+
+		if (Sound_CheckBASSError("Applying 3D attribs on channel %x", false, handle))
+		{
+			StopChannel(channel, 0);
+			return false;
+		}
+
+		return true;
+	}
+
+	void BassSoundBackend::StopChannel(int channel, unsigned int fadeout)
+	{
+		if (m_channels[channel] != NULL && BASS_ChannelIsActive(m_channels[channel]))
+		{
+			if (fadeout > 0)
+				BASS_ChannelSlideAttribute(m_channels[channel], BASS_ATTRIB_VOL, -1.0f, fadeout);
+			else
+				BASS_ChannelStop(m_channels[channel]);
+		}
+
+		m_channels[channel] = NULL;
+	}
+
+	void BassSoundBackend::PauseChannel(int channel)
+	{
+		if ((m_channels[channel] != NULL) && (BASS_ChannelIsActive(m_channels[channel]) == BASS_ACTIVE_PLAYING))
+			BASS_ChannelPause(m_channels[channel]);
+	}
+
+	void BassSoundBackend::ResumeChannel(int channel)
+	{
+		if ((m_channels[channel] != NULL) && (BASS_ChannelIsActive(m_channels[channel]) == BASS_ACTIVE_PAUSED))
+			BASS_ChannelStart(m_channels[channel]);
+	}
+
+	bool BassSoundBackend::IsChannelActive(int channel) const
+	{
+		return (m_channels[channel] != NULL && BASS_ChannelIsActive(m_channels[channel]));
+	}
+
+	void BassSoundBackend::SetChannelPosition(int channel, const Vector3& pos)
+	{
+		auto bassPos = BASS_3DVECTOR(pos.x, pos.y, pos.z);
+		BASS_ChannelSet3DPosition(m_channels[channel], &bassPos, NULL, NULL);
+	}
+
+	void BassSoundBackend::SetChannelAttributes(int channel, float pitch, float gain)
+	{
+		BASS_ChannelSetAttribute(m_channels[channel], BASS_ATTRIB_FREQ, 22050.0f * pitch);
+		BASS_ChannelSetAttribute(m_channels[channel], BASS_ATTRIB_VOL, gain);
+	}
+
+	void BassSoundBackend::SetChannelGain(int channel, float gain)
+	{
+		BASS_ChannelSetAttribute(m_channels[channel], BASS_ATTRIB_VOL, gain);
+	}
+
+	void BassSoundBackend::SetListener(const Vector3& pos, const Vector3& velocity, const Vector3& forward, const Vector3& up)
+	{
+		auto bassPos = BASS_3DVECTOR(pos.x, pos.y, pos.z);
+		auto bassVel = BASS_3DVECTOR(velocity.x, velocity.y, velocity.z);
+		auto bassForward = BASS_3DVECTOR(forward.x, forward.y, forward.z);
+		auto bassUp = BASS_3DVECTOR(up.x, up.y, up.z);
+		BASS_Set3DPosition(&bassPos, &bassVel, &bassForward, &bassUp);
+	}
+
+	void BassSoundBackend::SetReverb(int reverbType)
+	{
+		if (reverbType >= 0 && reverbType < (int)ReverbType::Count)
+			BASS_FXSetParameters(m_reverb, &BASS_ReverbTypes[reverbType]);
+	}
+
+	void BassSoundBackend::Update(float deltaTime)
+	{
+		BASS_Apply3D();
+	}
+}
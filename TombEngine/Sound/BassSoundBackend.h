@@ -0,0 +1,40 @@
+#pragma once
+#include <bass.h>
+#include <bass_fx.h>
+
+#include "Sound/SoundBackend.h"
+
+namespace TEN::Sound
+{
+	// Plays effects through BASS 3D mixdown with reverb and compressor applied to it.
+	class BassSoundBackend : public SoundBackend
+	{
+	private:
+		std::vector<HSAMPLE>  m_samples	   = {};
+		std::vector<HCHANNEL> m_channels   = {};
+		HSTREAM				  m_mixdown	   = NULL;
+		HFX					  m_reverb	   = NULL;
+		HFX					  m_compressor = NULL;
+
+	public:
+		bool Initialize(int sampleCount, int channelCount) override;
+
+		bool LoadSample(int sampleIndex, const float* data, int sampleCount, int frequency) override;
+		void FreeSample(int sampleIndex) override;
+
+		bool StartChannel(int channel, const SoundChannelParams& params) override;
+		void StopChannel(int channel, unsigned int fadeout) override;
+		void PauseChannel(int channel) override;
+		void ResumeChannel(int channel) override;
+		bool IsChannelActive(int channel) const override;
+
+		void SetChannelPosition(int channel, const Vector3& pos) override;
+		void SetChannelAttributes(int channel, float pitch, float gain) override;
+		void SetChannelGain(int channel, float gain) override;
+
+		void SetListener(const Vector3& pos, const Vector3& velocity, const Vector3& forward, const Vector3& up) override;
+		void SetReverb(int reverbType) override;
+
+		void Update(float deltaTime) override;
+	};
+}
@@ -0,0 +1,465 @@
+#include "framework.h"
+#include "Sound/SoftwareSoundBackend.h"
+
+#include <chrono>
+
+using namespace DirectX;
+
+namespace TEN::Sound
+{
+	const std::vector<float>& SoftwareSoundBackend::GetOutput() const
+	{
+		return m_output;
+	}
+
+	bool SoftwareSoundBackend::Initialize(int sampleCount, int channelCount)
+	{
+		m_samples.assign(sampleCount, Sample{});
+		m_channels.assign(channelCount, Channel{});
+		m_fadingChannels.clear();
+		m_output.clear();
+		m_frameRemainder = 0.0;
+		return true;
+	}
+
+	bool SoftwareSoundBackend::LoadSample(int sampleIndex, const float* data, int sampleCount, int frequency)
+	{
+		if (sampleCount <= 0 || frequency <= 0)
+			return false;
+
+		auto& sample = m_samples[sampleIndex];
+		sample.Data.assign(data, data + sampleCount);
+		sample.Frequency = frequency;
+		return true;
+	}
+
+	void SoftwareSoundBackend::FreeSample(int sampleIndex)
+	{
+		m_samples[sampleIndex] = Sample{};
+	}
+
+	bool SoftwareSoundBackend::StartChannel(int channel, const SoundChannelParams& params)
+	{
+		const auto& sample = m_samples[params.SampleIndex];
+		if (sample.Data.empty())
+			return false;
+
+		auto& newChannel = m_channels[channel];
+		newChannel = Channel{};
+		newChannel.IsActive = true;
+		newChannel.IsLooped = params.IsLooped;
+		newChannel.Is3D = params.Is3D;
+		newChannel.SampleIndex = params.SampleIndex;
+		newChannel.Cursor = std::max(params.StartTime, 0.0f) * sample.Frequency;
+		newChannel.Pitch = params.Pitch;
+		newChannel.Gain = params.Gain;
+		newChannel.Position = params.Position;
+		newChannel.MinDistance = params.MinDistance;
+		newChannel.MaxDistance = params.MaxDistance;
+
+		if (newChannel.IsLooped)
+			newChannel.Cursor = fmod(newChannel.Cursor, (double)sample.Data.size());
+
+		return true;
+	}
+
+	// Channel slot is freed right away; faded out channel keeps playing on its own.
+	void SoftwareSoundBackend::StopChannel(int channel, unsigned int fadeout)
+	{
+		auto& oldChannel = m_channels[channel];
+		if (oldChannel.IsActive && !oldChannel.IsPaused && fadeout > 0)
+		{
+			oldChannel.FadeStep = 1000.0f / (fadeout * (float)OUTPUT_FREQUENCY);
+			m_fadingChannels.push_back(oldChannel);
+		}
+
+		oldChannel = Channel{};
+	}
+
+	void SoftwareSoundBackend::PauseChannel(int channel)
+	{
+		if (m_channels[channel].IsActive)
+			m_channels[channel].IsPaused = true;
+	}
+
+	void SoftwareSoundBackend::ResumeChannel(int channel)
+	{
+		if (m_channels[channel].IsActive)
+			m_channels[channel].IsPaused = false;
+	}
+
+	bool SoftwareSoundBackend::IsChannelActive(int channel) const
+	{
+		return m_channels[channel].IsActive;
+	}
+
+	void SoftwareSoundBackend::SetChannelPosition(int channel, const Vector3& pos)
+	{
+		m_channels[channel].Position = pos;
+	}
+
+	void SoftwareSoundBackend::SetChannelAttributes(int channel, float pitch, float gain)
+	{
+		m_channels[channel].Pitch = pitch;
+		m_channels[channel].Gain = gain;
+	}
+
+	void SoftwareSoundBackend::SetChannelGain(int channel, float gain)
+	{
+		m_channels[channel].Gain = gain;
+	}
+
+	void SoftwareSoundBackend::SetListener(const Vector3& pos, const Vector3& velocity, const Vector3& forward, const Vector3& up)
+	{
+		m_listenerPos = pos;
+		m_listenerForward = forward;
+		m_listenerUp = up;
+	}
+
+	// No reverb is simulated; output is only used to keep playback state in sync.
+	void SoftwareSoundBackend::SetReverb(int reverbType)
+	{
+	}
+
+	// Renders as many output frames as elapsed since last update, keeping fractional remainder.
+	void SoftwareSoundBackend::Update(float deltaTime)
+	{
+		m_frameRemainder += deltaTime * OUTPUT_FREQUENCY;
+		int frameCount = (int)m_frameRemainder;
+		m_frameRemainder -= frameCount;
+
+		m_output.assign(frameCount * 2, 0.0f);
+		if (frameCount <= 0)
+			return;
+
+		if (m_channelBuffer.size() < frameCount)
+			m_channelBuffer.resize(frameCount);
+
+		float leftGain = 0.0f;
+		float rightGain = 0.0f;
+
+		for (auto& channel : m_channels)
+		{
+			if (!channel.IsActive || channel.IsPaused)
+				continue;
+
+			channel.IsActive = RenderChannel(channel, frameCount);
+			GetChannelGains(channel, leftGain, rightGain);
+			MixChannel(frameCount, leftGain, rightGain);
+		}
+
+		for (int i = (int)m_fadingChannels.size() - 1; i >= 0; i--)
+		{
+			auto& channel = m_fadingChannels[i];
+
+			bool isActive = RenderChannel(channel, frameCount);
+			GetChannelGains(channel, leftGain, rightGain);
+			MixChannel(frameCount, leftGain, rightGain);
+
+			if (!isActive)
+			{
+				channel = m_fadingChannels.back();
+				m_fadingChannels.pop_back();
+			}
+		}
+	}
+
+	// Resamples channel into mono buffer with linear interpolation. Returns false once channel has ended.
+	bool SoftwareSoundBackend::RenderChannel(Channel& channel, int frameCount)
+	{
+		const auto& sample = m_samples[channel.SampleIndex];
+		int sampleCount = (int)sample.Data.size();
+		double step = (sample.Frequency * (double)channel.Pitch) / OUTPUT_FREQUENCY;
+
+		for (int i = 0; i < frameCount; i++)
+		{
+			int index = (int)channel.Cursor;
+			if (index >= sampleCount || channel.FadeGain <= 0.0f || sampleCount == 0)
+			{
+				std::fill(m_channelBuffer.begin() + i, m_channelBuffer.begin() + frameCount, 0.0f);
+				return false;
+			}
+
+			int nextIndex = index + 1;
+			if (nextIndex >= sampleCount)
+				nextIndex = channel.IsLooped ? 0 : index;
+
+			float alpha = float(channel.Cursor - index);
+			m_channelBuffer[i] = (sample.Data[index] + ((sample.Data[nextIndex] - sample.Data[index]) * alpha)) * channel.FadeGain;
+
+			channel.FadeGain -= channel.FadeStep;
+			channel.Cursor += step;
+
+			if (channel.IsLooped && channel.Cursor >= sampleCount)
+				channel.Cursor -= sampleCount;
+		}
+
+		return (channel.FadeGain > 0.0f && (channel.IsLooped || channel.Cursor < sampleCount));
+	}
+
+	// Equal-power panning and BASS-like inverse distance rolloff between min and max distance.
+	void SoftwareSoundBackend::GetChannelGains(const Channel& channel, float& leftGain, float& rightGain) const
+	{
+		float gain = std::max(channel.Gain, 0.0f);
+
+		if (!channel.Is3D)
+		{
+			leftGain = rightGain = gain;
+			return;
+		}
+
+		auto direction = channel.Position - m_listenerPos;
+		float distance = direction.Length();
+
+		if (distance > channel.MinDistance && channel.MinDistance > 0.0f)
+		{
+			distance = std::min(distance, std::max(channel.MaxDistance, channel.MinDistance));
+			gain *= channel.MinDistance / (channel.MinDistance + (ROLLOFF_FACTOR * (distance - channel.MinDistance)));
+		}
+
+		float pan = 0.0f;
+		if (direction.LengthSquared() > FLT_EPSILON)
+		{
+			auto right = m_listenerUp.Cross(m_listenerForward);
+			right.Normalize();
+			direction.Normalize();
+			pan = std::clamp(direction.Dot(right), -1.0f, 1.0f);
+		}
+
+		float angle = (pan + 1.0f) * XM_PIDIV4;
+		leftGain = gain * cos(angle);
+		rightGain = gain * sin(angle);
+	}
+
+	// Accumulates mono buffer into stereo output, 4 frames per iteration.
+	void SoftwareSoundBackend::MixChannel(int frameCount, float leftGain, float rightGain)
+	{
+		if (leftGain <= 0.0f && rightGain <= 0.0f)
+			return;
+
+		const float* input = m_channelBuffer.data();
+		float* output = m_output.data();
+
+		auto gains = XMVectorSet(leftGain, rightGain, leftGain, rightGain);
+
+		int i = 0;
+		for (; (i + 4) <= frameCount; i += 4)
+		{
+			auto mono = XMLoadFloat4((const XMFLOAT4*)&input[i]);
+			auto* dest0 = (XMFLOAT4*)&output[i * 2];
+			auto* dest1 = (XMFLOAT4*)&output[(i * 2) + 4];
+
+			XMStoreFloat4(dest0, XMVectorMultiplyAdd(XMVectorMergeXY(mono, mono), gains, XMLoadFloat4(dest0)));
+			XMStoreFloat4(dest1, XMVectorMultiplyAdd(XMVectorMergeZW(mono, mono), gains, XMLoadFloat4(dest1)));
+		}
+
+		for (; i < frameCount; i++)
+		{
+			output[i * 2] += input[i] * leftGain;
+			output[(i * 2) + 1] += input[i] * rightGain;
+		}
+	}
+
+	// Plays generated samples through mixer and checks output levels, panning, rolloff, resampling, fades and
+	// frame accounting against expected values. Logs time to mix full set of channels for one game frame.
+	bool TestSoftwareSoundBackend()
+	{
+		constexpr auto FREQUENCY		 = 44100;
+		constexpr auto FRAME_TIME		 = 1.0f / 30;
+		constexpr auto CHANNEL_COUNT	 = 32;
+		constexpr auto TOLERANCE		 = 0.001f;
+		constexpr auto BENCHMARK_UPDATES = 1000;
+
+		bool isPassed = true;
+		auto check = [&](bool condition, const std::string& message)
+		{
+			if (!condition)
+			{
+				TENLog("Software mixer: " + message, LogLevel::Error);
+				isPassed = false;
+			}
+		};
+
+		auto isNear = [](float value, float expectedValue) { return (abs(value - expectedValue) <= TOLERANCE); };
+
+		// Constant sample makes expected output exact, ramp shows resampling.
+		auto constantSample = std::vector<float>(FREQUENCY, 0.5f);
+		auto rampSample = std::vector<float>(FREQUENCY);
+		for (int i = 0; i < rampSample.size(); i++)
+			rampSample[i] = (float)i / rampSample.size();
+
+		auto backend = SoftwareSoundBackend();
+		auto init = [&]()
+		{
+			backend.Initialize(2, CHANNEL_COUNT);
+			backend.LoadSample(0, constantSample.data(), (int)constantSample.size(), FREQUENCY);
+			backend.LoadSample(1, rampSample.data(), (int)rampSample.size(), FREQUENCY / 2);
+			backend.SetListener(Vector3::Zero, Vector3::Zero, Vector3::UnitZ, Vector3::UnitY);
+		};
+
+		auto getLevels = [&](float& left, float& right)
+		{
+			const auto& output = backend.GetOutput();
+			left = right = 0.0f;
+			if (output.size() >= 2)
+			{
+				left = output[output.size() - 2];
+				right = output[output.size() - 1];
+			}
+		};
+
+		auto params = SoundChannelParams{};
+		float left = 0.0f;
+		float right = 0.0f;
+
+		// 2D channel plays at its gain on both sides; two channels add up.
+		init();
+		params.Gain = 0.8f;
+		backend.StartChannel(0, params);
+		backend.Update(FRAME_TIME);
+		getLevels(left, right);
+		check(isNear(left, 0.4f) && isNear(right, 0.4f), "2D: channel isn't mixed at its gain.");
+
+		backend.StartChannel(1, params);
+		backend.Update(FRAME_TIME);
+		getLevels(left, right);
+		check(isNear(left, 0.8f) && isNear(right, 0.8f), "2D: two channels don't add up.");
+
+		// 3D channels are panned with equal power and attenuated beyond min distance.
+		auto check3D = [&](const Vector3& pos, float expectedLeft, float expectedRight, const std::string& name)
+		{
+			init();
+			params = SoundChannelParams{};
+			params.Is3D = true;
+			params.Position = pos;
+			params.MinDistance = BLOCK(1);
+			params.MaxDistance = BLOCK(8);
+			backend.StartChannel(0, params);
+			backend.Update(FRAME_TIME);
+			getLevels(left, right);
+			check(isNear(left, expectedLeft * 0.5f) && isNear(right, expectedRight * 0.5f), "3D: wrong levels for " + name + " source.");
+		};
+
+		check3D(Vector3(BLOCK(1), 0.0f, 0.0f), 0.0f, 1.0f, "right");
+		check3D(Vector3(-BLOCK(1), 0.0f, 0.0f), 1.0f, 0.0f, "left");
+		check3D(Vector3(0.0f, 0.0f, BLOCK(1)), SQRT_2 / 2, SQRT_2 / 2, "front");
+		check3D(Vector3(BLOCK(3), 0.0f, 0.0f), 0.0f, 1.0f / 2.0f, "distant");	 // Min / (min + (0.5 * 2 * min)).
+		check3D(Vector3(BLOCK(20), 0.0f, 0.0f), 0.0f, 1.0f / 4.5f, "clamped"); // Distance clamped to max.
+
+		// Half rate ramp is stretched to twice its length, and pitch speeds it up again.
+		init();
+		params = SoundChannelParams{};
+		params.SampleIndex = 1;
+		backend.StartChannel(0, params);
+		backend.Update(0.5f);
+		getLevels(left, right);
+		check(isNear(left, 0.25f), "Resampling: half rate sample isn't stretched.");
+
+		init();
+		params.Pitch = 2.0f;
+		backend.StartChannel(0, params);
+		backend.Update(0.5f);
+		getLevels(left, right);
+		check(isNear(left, 0.5f), "Pitch: sample isn't played faster.");
+
+		// Every frame, whether mixed 4 at a time or in scalar tail, lands in its own slot with its side's gain.
+		init();
+		params = SoundChannelParams{};
+		params.SampleIndex = 1;
+		params.Is3D = true;
+		params.Position = Vector3(BLOCK(1), 0.0f, BLOCK(1));
+		params.MinDistance = BLOCK(2);
+		params.MaxDistance = BLOCK(8);
+		backend.StartChannel(0, params);
+		backend.Update(0.1f);
+
+		float angle = ((SQRT_2 / 2) + 1.0f) * PI_DIV_4;
+		const auto& output = backend.GetOutput();
+		for (int i = 0; i < (output.size() / 2); i++)
+		{
+			float level = (i * 0.5f) / rampSample.size();
+			if (abs(output[i * 2] - (level * cos(angle))) > EPSILON || abs(output[(i * 2) + 1] - (level * sin(angle))) > EPSILON)
+			{
+				check(false, "Mixing: frame " + std::to_string(i) + " doesn't match panned ramp.");
+				break;
+			}
+		}
+
+		// Looped channel wraps around instead of ending.
+		init();
+		params = SoundChannelParams{};
+		params.IsLooped = true;
+		backend.StartChannel(0, params);
+		backend.Update(1.5f);
+		getLevels(left, right);
+		check(backend.IsChannelActive(0) && isNear(left, 0.5f), "Loop: channel ended or went silent.");
+
+		// Stopped channel frees its slot right away and fades out linearly.
+		backend.StopChannel(0, 100);
+		check(!backend.IsChannelActive(0), "Fade: stopped channel still holds slot.");
+		backend.Update(0.05f);
+		getLevels(left, right);
+		check(isNear(left, 0.25f), "Fade: level halfway through fade isn't half.");
+		backend.Update(0.1f);
+		getLevels(left, right);
+		check(isNear(left, 0.0f), "Fade: channel still audible after fade.");
+
+		// Long update renders same frames as several short ones, with fractional frames carried over.
+		auto renderFrames = [&](float deltaTime, int updateCount)
+		{
+			init();
+			params = SoundChannelParams{};
+			params.SampleIndex = 1;
+			params.Pitch = 1.3f;
+			backend.StartChannel(0, params);
+
+			auto frames = std::vector<float>{};
+			for (int i = 0; i < updateCount; i++)
+			{
+				backend.Update(deltaTime);
+				frames.insert(frames.end(), backend.GetOutput().begin(), backend.GetOutput().end());
+			}
+
+			return frames;
+		};
+
+		auto longFrames = renderFrames(FRAME_TIME * 3, 1);
+		auto shortFrames = renderFrames(FRAME_TIME, 3);
+		check(longFrames.size() == shortFrames.size(), "Frames: several short updates rendered different frame count than one long update.");
+		for (int i = 0; i < std::min(longFrames.size(), shortFrames.size()); i++)
+		{
+			if (longFrames[i] != shortFrames[i])
+			{
+				check(false, "Frames: several short updates rendered different output than one long update.");
+				break;
+			}
+		}
+
+		auto oddFrames = renderFrames(0.0101f, 99);
+		check(abs((int)(oddFrames.size() / 2) - (int)(0.0101f * 99 * FREQUENCY)) <= 1, "Frames: fractional frames were lost.");
+
+		// Time mixing of all channels, as when every channel is bound to 3D voice.
+		init();
+		for (int i = 0; i < CHANNEL_COUNT; i++)
+		{
+			params = SoundChannelParams{};
+			params.IsLooped = true;
+			params.Is3D = true;
+			params.Position = Vector3(BLOCK(i - (CHANNEL_COUNT / 2)), 0.0f, BLOCK(2));
+			params.MinDistance = BLOCK(1);
+			params.MaxDistance = BLOCK(8);
+			params.Pitch = 0.5f + ((float)i / CHANNEL_COUNT);
+			backend.StartChannel(i, params);
+		}
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < BENCHMARK_UPDATES; i++)
+			backend.Update(FRAME_TIME);
+		auto mixTime = std::chrono::high_resolution_clock::now() - startTime;
+
+		TENLog("Software mixer: " + std::to_string(std::chrono::duration<double, std::micro>(mixTime).count() / BENCHMARK_UPDATES) +
+			   " us to mix " + std::to_string(CHANNEL_COUNT) + " channels for one game frame.", LogLevel::Info);
+
+		return isPassed;
+	}
+}
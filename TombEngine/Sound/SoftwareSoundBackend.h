@@ -0,0 +1,86 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+#include "Sound/SoundBackend.h"
+
+namespace TEN::Sound
+{
+	// Mixes effects into stereo float buffer without touching audio device.
+	// Used when running headless, so sound logic works on machines without audio output.
+	class SoftwareSoundBackend : public SoundBackend
+	{
+	private:
+		// Constants
+		static constexpr auto OUTPUT_FREQUENCY = 44100;
+		static constexpr auto ROLLOFF_FACTOR   = 0.5f; // Matches BASS 3D factors.
+
+		struct Sample
+		{
+			std::vector<float> Data		 = {};
+			int				   Frequency = 0;
+		};
+
+		struct Channel
+		{
+			bool IsActive = false;
+			bool IsPaused = false;
+			bool IsLooped = false;
+			bool Is3D	  = false;
+
+			int	   SampleIndex = 0;
+			double Cursor	   = 0.0; // In sample frames.
+			float  Pitch	   = 1.0f;
+			float  Gain		   = 1.0f;
+			float  FadeGain	   = 1.0f;
+			float  FadeStep	   = 0.0f; // Per output frame. Channel ends when fade reaches zero.
+
+			Vector3 Position	= Vector3::Zero;
+			float	MinDistance = 0.0f;
+			float	MaxDistance = 0.0f;
+		};
+
+		std::vector<Sample>	 m_samples		  = {};
+		std::vector<Channel> m_channels		  = {};
+		std::vector<Channel> m_fadingChannels = {}; // Stopped channels which play until fadeout ends.
+		std::vector<float>	 m_channelBuffer  = {}; // Mono scratch buffer of single channel.
+		std::vector<float>	 m_output		  = {}; // Interleaved stereo output of last update.
+
+		Vector3 m_listenerPos	  = Vector3::Zero;
+		Vector3 m_listenerForward = Vector3::UnitZ;
+		Vector3 m_listenerUp	  = Vector3::UnitY;
+		double	m_frameRemainder  = 0.0;
+
+	public:
+		// Getters
+		const std::vector<float>& GetOutput() const;
+
+		bool Initialize(int sampleCount, int channelCount) override;
+
+		bool LoadSample(int sampleIndex, const float* data, int sampleCount, int frequency) override;
+		void FreeSample(int sampleIndex) override;
+
+		bool StartChannel(int channel, const SoundChannelParams& params) override;
+		void StopChannel(int channel, unsigned int fadeout) override;
+		void PauseChannel(int channel) override;
+		void ResumeChannel(int channel) override;
+		bool IsChannelActive(int channel) const override;
+
+		void SetChannelPosition(int channel, const Vector3& pos) override;
+		void SetChannelAttributes(int channel, float pitch, float gain) override;
+		void SetChannelGain(int channel, float gain) override;
+
+		void SetListener(const Vector3& pos, const Vector3& velocity, const Vector3& forward, const Vector3& up) override;
+		void SetReverb(int reverbType) override;
+
+		void Update(float deltaTime) override;
+
+	private:
+		// Helpers
+		bool RenderChannel(Channel& channel, int frameCount);
+		void GetChannelGains(const Channel& channel, float& leftGain, float& rightGain) const;
+		void MixChannel(int frameCount, float leftGain, float rightGain);
+	};
+
+	bool TestSoftwareSoundBackend();
+}
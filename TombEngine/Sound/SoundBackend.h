@@ -0,0 +1,51 @@
+#pragma once
+#include <SimpleMath.h>
+
+namespace TEN::Sound
+{
+	// Parameters of effect channel at start. Position and attributes may be changed while it plays.
+	struct SoundChannelParams
+	{
+		int	 SampleIndex = 0;
+		bool IsLooped	 = false;
+		bool Is3D		 = false;
+
+		Vector3 Position	= Vector3::Zero;
+		float	MinDistance = 0.0f; // Distance at which sound starts to attenuate.
+		float	MaxDistance = 0.0f; // Distance beyond which sound isn't attenuated further.
+
+		float StartTime = 0.0f; // In seconds.
+		float Pitch		= 1.0f;
+		float Gain		= 1.0f;
+	};
+
+	// Device side of sound effects. Samples and channels are addressed by index, so game code
+	// keeps its own bookkeeping and backend only plays what it is told to.
+	class SoundBackend
+	{
+	public:
+		virtual ~SoundBackend() = default;
+
+		virtual bool Initialize(int sampleCount, int channelCount) = 0;
+
+		// Samples are mono 32-bit float PCM.
+		virtual bool LoadSample(int sampleIndex, const float* data, int sampleCount, int frequency) = 0;
+		virtual void FreeSample(int sampleIndex) = 0;
+
+		virtual bool StartChannel(int channel, const SoundChannelParams& params) = 0;
+		virtual void StopChannel(int channel, unsigned int fadeout) = 0;
+		virtual void PauseChannel(int channel) = 0;	 // Only affects playing channel.
+		virtual void ResumeChannel(int channel) = 0; // Only affects paused channel.
+		virtual bool IsChannelActive(int channel) const = 0;
+
+		virtual void SetChannelPosition(int channel, const Vector3& pos) = 0;
+		virtual void SetChannelAttributes(int channel, float pitch, float gain) = 0;
+		virtual void SetChannelGain(int channel, float gain) = 0;
+
+		virtual void SetListener(const Vector3& pos, const Vector3& velocity, const Vector3& forward, const Vector3& up) = 0;
+		virtual void SetReverb(int reverbType) = 0;
+
+		// Called once per frame after all channel and listener changes.
+		virtual void Update(float deltaTime) = 0;
+	};
+}
@@ -0,0 +1,444 @@
+#include "framework.h"
+#include "Sound/VoiceManager.h"
+
+#include <chrono>
+#include <random>
+
+namespace TEN::Sound
+{
+	int VoiceManager::GetVoiceCount() const
+	{
+		return (int)m_voices.size();
+	}
+
+	int VoiceManager::GetChannelCount() const
+	{
+		return (int)m_channelVoices.size();
+	}
+
+	VirtualVoice& VoiceManager::GetVoice(int voiceIndex)
+	{
+		return m_voices[voiceIndex];
+	}
+
+	const VirtualVoice& VoiceManager::GetVoice(int voiceIndex) const
+	{
+		return m_voices[voiceIndex];
+	}
+
+	int VoiceManager::GetChannelVoice(int channel) const
+	{
+		return m_channelVoices[channel];
+	}
+
+	const std::vector<VoiceChange>& VoiceManager::GetChanges() const
+	{
+		return m_changes;
+	}
+
+	void VoiceManager::Initialize(int voiceCount, int channelCount)
+	{
+		m_voices.assign(voiceCount, VirtualVoice{});
+		m_channelVoices.assign(channelCount, NO_VOICE);
+		m_ranking.reserve(voiceCount);
+		m_changes.reserve(channelCount * 2);
+		Clear();
+	}
+
+	void VoiceManager::Clear()
+	{
+		for (auto& voice : m_voices)
+			voice = VirtualVoice{};
+
+		for (auto& voiceIndex : m_channelVoices)
+			voiceIndex = NO_VOICE;
+
+		// Free list is popped from back, so lowest indices are handed out first.
+		m_freeVoices.clear();
+		for (int i = (int)m_voices.size() - 1; i >= 0; i--)
+			m_freeVoices.push_back(i);
+
+		m_changes.clear();
+	}
+
+	// Finds voice of effect playing at origin. Null origin matches any voice of effect, and omnipresent voices match any origin.
+	int VoiceManager::Find(int effectID, const Vector3* origin, float matchRadius) const
+	{
+		for (int i = 0; i < m_voices.size(); i++)
+		{
+			const auto& voice = m_voices[i];
+			if (!voice.IsActive || voice.EffectID != effectID)
+				continue;
+
+			if (origin == nullptr || voice.IsOmnipresent)
+				return i;
+
+			if (Vector3::Distance(*origin, voice.Origin) < matchRadius)
+				return i;
+		}
+
+		return NO_VOICE;
+	}
+
+	// Adds new unbound voice. If all voices are in use, least audible unbound voice is replaced,
+	// unless new one is even less audible.
+	int VoiceManager::Play(const VirtualVoice& voice, const Vector3& listenerPos)
+	{
+		float audibility = GetAudibility(voice, listenerPos);
+
+		int voiceIndex = NO_VOICE;
+		if (!m_freeVoices.empty())
+		{
+			voiceIndex = m_freeVoices.back();
+			m_freeVoices.pop_back();
+		}
+		else
+		{
+			float minAudibility = audibility;
+			for (int i = 0; i < m_voices.size(); i++)
+			{
+				if (m_voices[i].Channel == NO_CHANNEL && m_voices[i].Audibility < minAudibility)
+				{
+					minAudibility = m_voices[i].Audibility;
+					voiceIndex = i;
+				}
+			}
+
+			if (voiceIndex == NO_VOICE)
+				return NO_VOICE;
+		}
+
+		auto& newVoice = m_voices[voiceIndex];
+		newVoice = voice;
+		newVoice.IsActive = true;
+		newVoice.IsRefreshed = true;
+		newVoice.Time = 0.0f;
+		newVoice.Audibility = audibility;
+		newVoice.Channel = NO_CHANNEL;
+		return voiceIndex;
+	}
+
+	// Binds voice right away, taking channel from least audible bound voice if needed.
+	// Returns channel, or NO_CHANNEL if voice isn't audible enough to get one.
+	int VoiceManager::Bind(int voiceIndex)
+	{
+		auto& voice = m_voices[voiceIndex];
+		if (voice.Channel != NO_CHANNEL)
+			return voice.Channel;
+
+		if (voice.Audibility <= 0.0f)
+			return NO_CHANNEL;
+
+		int channel = GetFreeChannel();
+		if (channel == NO_CHANNEL)
+		{
+			float minScore = voice.Audibility;
+			for (int i = 0; i < m_channelVoices.size(); i++)
+			{
+				float score = GetScore(m_channelVoices[i]);
+				if (score < minScore)
+				{
+					minScore = score;
+					channel = i;
+				}
+			}
+
+			if (channel == NO_CHANNEL)
+				return NO_CHANNEL;
+
+			Unbind(m_channelVoices[channel]);
+		}
+
+		AssignChannel(voiceIndex, channel);
+		return channel;
+	}
+
+	void VoiceManager::Unbind(int voiceIndex)
+	{
+		auto& voice = m_voices[voiceIndex];
+		if (voice.Channel == NO_CHANNEL)
+			return;
+
+		m_channelVoices[voice.Channel] = NO_VOICE;
+		voice.Channel = NO_CHANNEL;
+	}
+
+	void VoiceManager::Release(int voiceIndex)
+	{
+		auto& voice = m_voices[voiceIndex];
+		if (!voice.IsActive)
+			return;
+
+		Unbind(voiceIndex);
+		voice = VirtualVoice{};
+		m_freeVoices.push_back(voiceIndex);
+	}
+
+	// Advances voices, drops ended ones and rebinds channels to most audible voices.
+	// Changes are collected in GetChanges() until next update.
+	void VoiceManager::Update(const Vector3& listenerPos, float deltaTime)
+	{
+		m_changes.clear();
+		m_ranking.clear();
+
+		for (int i = 0; i < m_voices.size(); i++)
+		{
+			auto& voice = m_voices[i];
+			if (!voice.IsActive)
+				continue;
+
+			if (voice.IsLooped)
+			{
+				if (!voice.IsRefreshed)
+				{
+					if (voice.Channel != NO_CHANNEL)
+						m_changes.push_back(VoiceChange{ VoiceChangeType::Stop, i, voice.Channel });
+
+					Release(i);
+					continue;
+				}
+
+				voice.IsRefreshed = false;
+			}
+			else
+			{
+				voice.Time += deltaTime * voice.Pitch;
+
+				// Bound voices end when their channel does; virtual ones end by time.
+				if (voice.Channel == NO_CHANNEL && voice.Time >= voice.Duration)
+				{
+					Release(i);
+					continue;
+				}
+			}
+
+			voice.Audibility = GetAudibility(voice, listenerPos);
+			m_ranking.push_back(i);
+		}
+
+		int channelCount = (int)m_channelVoices.size();
+		int topCount = std::min((int)m_ranking.size(), channelCount);
+
+		if (m_ranking.size() > channelCount)
+		{
+			std::nth_element(
+				m_ranking.begin(), m_ranking.begin() + channelCount, m_ranking.end(),
+				[this](int voiceIndex0, int voiceIndex1) { return (GetScore(voiceIndex0) > GetScore(voiceIndex1)); });
+		}
+
+		// Demote first so that freed channels can be handed to promoted voices.
+		for (int i = 0; i < m_ranking.size(); i++)
+		{
+			int voiceIndex = m_ranking[i];
+			auto& voice = m_voices[voiceIndex];
+
+			if (voice.Channel != NO_CHANNEL && (i >= topCount || voice.Audibility <= 0.0f))
+			{
+				m_changes.push_back(VoiceChange{ VoiceChangeType::Demote, voiceIndex, voice.Channel });
+				Unbind(voiceIndex);
+			}
+		}
+
+		for (int i = 0; i < topCount; i++)
+		{
+			int voiceIndex = m_ranking[i];
+			auto& voice = m_voices[voiceIndex];
+
+			if (voice.Channel != NO_CHANNEL || voice.Audibility <= 0.0f)
+				continue;
+
+			if (!voice.IsLooped && (voice.Duration - voice.Time) < PROMOTE_TIME_MIN)
+				continue;
+
+			int channel = GetFreeChannel();
+			if (channel == NO_CHANNEL)
+				break;
+
+			AssignChannel(voiceIndex, channel);
+			m_changes.push_back(VoiceChange{ VoiceChangeType::Promote, voiceIndex, channel });
+		}
+	}
+
+	// Linear falloff to zero at voice radius, scaled by gain and priority. Omnipresent voices don't attenuate.
+	float VoiceManager::GetAudibility(const VirtualVoice& voice, const Vector3& listenerPos)
+	{
+		float attenuation = 1.0f;
+		if (!voice.IsOmnipresent)
+		{
+			if (voice.Radius <= 0.0f)
+				return 0.0f;
+
+			float distance = Vector3::Distance(voice.Origin, listenerPos);
+			attenuation = std::clamp(1.0f - (distance / voice.Radius), 0.0f, 1.0f);
+		}
+
+		return (std::clamp(voice.Gain, 0.0f, 1.0f) * attenuation * voice.Priority);
+	}
+
+	float VoiceManager::GetScore(int voiceIndex) const
+	{
+		const auto& voice = m_voices[voiceIndex];
+		return ((voice.Channel != NO_CHANNEL) ? (voice.Audibility * BOUND_SCORE_BONUS) : voice.Audibility);
+	}
+
+	int VoiceManager::GetFreeChannel() const
+	{
+		for (int i = 0; i < m_channelVoices.size(); i++)
+		{
+			if (m_channelVoices[i] == NO_VOICE)
+				return i;
+		}
+
+		return NO_CHANNEL;
+	}
+
+	void VoiceManager::AssignChannel(int voiceIndex, int channel)
+	{
+		m_channelVoices[channel] = voiceIndex;
+		m_voices[voiceIndex].Channel = channel;
+	}
+
+	// Checks ranking, hysteresis, time keeping and voice replacement of manager against hand-made voice sets,
+	// and logs update time of full voice pool.
+	bool TestVoiceManager()
+	{
+		constexpr auto CHANNEL_COUNT		= 4;
+		constexpr auto VOICE_COUNT			= 16;
+		constexpr auto FRAME_TIME			= 1.0f / 30;
+		constexpr auto BENCHMARK_CHANNELS	= 32;
+		constexpr auto BENCHMARK_UPDATES	= 10000;
+
+		bool isPassed = true;
+		auto check = [&](bool condition, const std::string& message)
+		{
+			if (!condition)
+			{
+				TENLog("Voice manager: " + message, LogLevel::Error);
+				isPassed = false;
+			}
+		};
+
+		auto makeVoice = [](const Vector3& origin, float gain, bool isLooped = false, float duration = 10.0f)
+		{
+			auto voice = VirtualVoice{};
+			voice.Origin = origin;
+			voice.Gain = gain;
+			voice.Radius = BLOCK(10);
+			voice.IsLooped = isLooped;
+			voice.Duration = duration;
+			return voice;
+		};
+
+		auto countChanges = [](const VoiceManager& manager, VoiceChangeType type)
+		{
+			const auto& changes = manager.GetChanges();
+			return (int)std::count_if(changes.begin(), changes.end(), [type](const VoiceChange& change) { return (change.Type == type); });
+		};
+
+		auto listenerPos = Vector3::Zero;
+		auto manager = VoiceManager();
+
+		// Only most audible voices get channels. Voices are played farthest first, so index order doesn't help.
+		manager.Initialize(VOICE_COUNT, CHANNEL_COUNT);
+		for (int i = 0; i < VOICE_COUNT; i++)
+			manager.Play(makeVoice(Vector3(BLOCK(VOICE_COUNT - i) / 2.0f, 0.0f, 0.0f), 1.0f), listenerPos);
+
+		manager.Update(listenerPos, FRAME_TIME);
+		check(countChanges(manager, VoiceChangeType::Promote) == CHANNEL_COUNT, "Ranking: not every channel was filled.");
+		for (int channel = 0; channel < CHANNEL_COUNT; channel++)
+		{
+			int voiceIndex = manager.GetChannelVoice(channel);
+			check(voiceIndex >= (VOICE_COUNT - CHANNEL_COUNT), "Ranking: channel " + std::to_string(channel) + " is bound to voice which isn't among nearest.");
+		}
+
+		// Omnipresent voices rank by gain and priority regardless of distance.
+		auto omnipresentVoice = makeVoice(Vector3(BLOCK(100), 0.0f, 0.0f), 1.0f);
+		omnipresentVoice.IsOmnipresent = true;
+		omnipresentVoice.Priority = 2.0f;
+		int omnipresentIndex = manager.Play(omnipresentVoice, listenerPos);
+		manager.Update(listenerPos, FRAME_TIME);
+		check(manager.GetVoice(omnipresentIndex).Channel != NO_CHANNEL, "Ranking: omnipresent voice with high priority wasn't bound.");
+		check(countChanges(manager, VoiceChangeType::Demote) == 1, "Ranking: binding omnipresent voice didn't demote exactly one voice.");
+
+		// Bound voice keeps its channel against slightly more audible one, but not against much more audible one.
+		manager.Initialize(VOICE_COUNT, 1);
+		int boundIndex = manager.Play(makeVoice(Vector3(BLOCK(5), 0.0f, 0.0f), 1.0f), listenerPos);
+		manager.Update(listenerPos, FRAME_TIME);
+		int closerIndex = manager.Play(makeVoice(Vector3(BLOCK(4.75f), 0.0f, 0.0f), 1.0f), listenerPos);
+		manager.Update(listenerPos, FRAME_TIME);
+		check(manager.GetVoice(boundIndex).Channel != NO_CHANNEL && manager.GetChanges().empty(), "Hysteresis: slightly closer voice took channel.");
+
+		manager.GetVoice(closerIndex).Origin = Vector3(BLOCK(1), 0.0f, 0.0f);
+		manager.Update(listenerPos, FRAME_TIME);
+		check(manager.GetVoice(closerIndex).Channel != NO_CHANNEL, "Hysteresis: much closer voice didn't take channel.");
+		check(countChanges(manager, VoiceChangeType::Demote) == 1 && countChanges(manager, VoiceChangeType::Promote) == 1, "Hysteresis: channel swap wasn't reported as demote and promote.");
+
+		// Virtual one-shot voices advance by elapsed time and pitch, so one long update equals several short ones.
+		manager.Initialize(VOICE_COUNT, 1);
+		manager.Play(makeVoice(Vector3(BLOCK(1), 0.0f, 0.0f), 1.0f, true), listenerPos);
+		auto oneShotVoice = makeVoice(Vector3(BLOCK(2), 0.0f, 0.0f), 1.0f, false, 1.0f);
+		oneShotVoice.Pitch = 2.0f;
+		int oneShotIndex0 = manager.Play(oneShotVoice, listenerPos);
+		int oneShotIndex1 = manager.Play(oneShotVoice, listenerPos);
+		manager.GetVoice(0).IsRefreshed = true;
+		manager.Update(listenerPos, FRAME_TIME * 4);
+		float longUpdateTime = manager.GetVoice(oneShotIndex0).Time;
+		check(abs(longUpdateTime - (FRAME_TIME * 4 * oneShotVoice.Pitch)) < 0.0001f, "Time: virtual voice didn't advance by elapsed time and pitch.");
+
+		for (int i = 0; i < 4; i++)
+		{
+			manager.GetVoice(0).IsRefreshed = true;
+			manager.Update(listenerPos, FRAME_TIME);
+		}
+
+		check(abs(manager.GetVoice(oneShotIndex1).Time - (longUpdateTime * 2)) < 0.0001f, "Time: several short updates differ from one long update.");
+
+		manager.GetVoice(0).IsRefreshed = true;
+		manager.Update(listenerPos, 1.0f);
+		check(!manager.GetVoice(oneShotIndex0).IsActive, "Time: virtual voice didn't end after its duration.");
+
+		// Looped voice which isn't refreshed is stopped and its channel reported.
+		manager.Update(listenerPos, FRAME_TIME);
+		check(!manager.GetVoice(0).IsActive && countChanges(manager, VoiceChangeType::Stop) == 1, "Loop: voice which wasn't refreshed kept playing.");
+
+		// One-shot voice about to end isn't worth binding.
+		manager.Initialize(VOICE_COUNT, 1);
+		int endingIndex = manager.Play(makeVoice(Vector3(BLOCK(1), 0.0f, 0.0f), 1.0f, false, 0.05f), listenerPos);
+		manager.Update(listenerPos, 0.0f);
+		check(manager.GetVoice(endingIndex).Channel == NO_CHANNEL, "Promotion: voice about to end was bound.");
+
+		// When pool is full, least audible unbound voice is replaced, but not by even less audible one.
+		manager.Initialize(2, 1);
+		manager.Play(makeVoice(Vector3(BLOCK(2), 0.0f, 0.0f), 1.0f), listenerPos);
+		int quietIndex = manager.Play(makeVoice(Vector3(BLOCK(6), 0.0f, 0.0f), 1.0f), listenerPos);
+		check(manager.Play(makeVoice(Vector3(BLOCK(8), 0.0f, 0.0f), 1.0f), listenerPos) == NO_VOICE, "Pool: quieter voice replaced existing one.");
+		check(manager.Play(makeVoice(Vector3(BLOCK(4), 0.0f, 0.0f), 1.0f), listenerPos) == quietIndex, "Pool: louder voice didn't replace quietest one.");
+
+		// Time update of full pool with listener moving through random voices.
+		auto generator = std::mt19937(VOICE_COUNT_MAX);
+		auto getRandom = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(generator); };
+
+		manager.Initialize(VOICE_COUNT_MAX, BENCHMARK_CHANNELS);
+		for (int i = 0; i < VOICE_COUNT_MAX; i++)
+			manager.Play(makeVoice(Vector3(getRandom(0.0f, BLOCK(32)), 0.0f, getRandom(0.0f, BLOCK(32))), getRandom(0.5f, 1.0f), true), listenerPos);
+
+		int changeCount = 0;
+		auto startTime = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < BENCHMARK_UPDATES; i++)
+		{
+			for (int j = 0; j < VOICE_COUNT_MAX; j++)
+				manager.GetVoice(j).IsRefreshed = true;
+
+			listenerPos = Vector3(BLOCK(16) + (sin(i * 0.01f) * BLOCK(16)), 0.0f, BLOCK(16));
+			manager.Update(listenerPos, FRAME_TIME);
+			changeCount += (int)manager.GetChanges().size();
+		}
+		auto updateTime = std::chrono::high_resolution_clock::now() - startTime;
+
+		TENLog("Voice manager: " + std::to_string(std::chrono::duration<double, std::micro>(updateTime).count() / BENCHMARK_UPDATES) +
+			   " us per update of " + std::to_string(VOICE_COUNT_MAX) + " voices on " + std::to_string(BENCHMARK_CHANNELS) + " channels, " +
+			   std::to_string((float)changeCount / BENCHMARK_UPDATES) + " channel changes per update.", LogLevel::Info);
+
+		return isPassed;
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <vector>
+#include <SimpleMath.h>
+
+namespace TEN::Sound
+{
+	constexpr auto VOICE_COUNT_MAX = 256;
+	constexpr auto NO_VOICE		   = -1;
+	constexpr auto NO_CHANNEL	   = -1;
+
+	// Logical sound instance. It is tracked for its whole lifetime, but only heard while bound to real channel.
+	struct VirtualVoice
+	{
+		bool IsActive	   = false;
+		bool IsOmnipresent = false;
+		bool IsLooped	   = false;
+		bool IsRefreshed   = false; // Looped voices which aren't refreshed between updates are stopped.
+
+		int		EffectID	= 0;
+		int		SampleIndex = 0;
+		Vector3 Origin		= Vector3::Zero;
+
+		float Gain	   = 0.0f; // Unattenuated.
+		float Pitch	   = 1.0f;
+		float Radius   = 0.0f;
+		float Priority = 1.0f;
+
+		float Time		 = 0.0f; // Playback position in seconds.
+		float Duration	 = 0.0f;
+		float Audibility = 0.0f; // Attenuated gain multiplied by priority, used for ranking.
+		int	  Channel	 = NO_CHANNEL;
+	};
+
+	enum class VoiceChangeType
+	{
+		Promote, // Voice got channel and must start playing on it from its current time.
+		Demote,	 // Voice lost its channel, but keeps playing virtually.
+		Stop	 // Voice ended while bound to channel.
+	};
+
+	struct VoiceChange
+	{
+		VoiceChangeType Type	   = VoiceChangeType::Stop;
+		int				VoiceIndex = NO_VOICE;
+		int				Channel	   = NO_CHANNEL;
+	};
+
+	// Tracks many virtual voices and keeps most audible ones bound to limited number of channels.
+	// Manager doesn't talk to audio device; it reports channel changes which caller applies.
+	class VoiceManager
+	{
+	private:
+		// Constants
+		static constexpr auto BOUND_SCORE_BONUS = 1.1f; // Keeps voices of similar audibility from swapping channels every frame.
+		static constexpr auto PROMOTE_TIME_MIN	= 0.1f; // One-shot voices with less time left aren't worth binding.
+
+		std::vector<VirtualVoice> m_voices		  = {};
+		std::vector<int>		  m_freeVoices	  = {};
+		std::vector<int>		  m_channelVoices = {};
+		std::vector<int>		  m_ranking		  = {};
+		std::vector<VoiceChange>  m_changes		  = {};
+
+	public:
+		// Getters
+		int								GetVoiceCount() const;
+		int								GetChannelCount() const;
+		VirtualVoice&					GetVoice(int voiceIndex);
+		const VirtualVoice&				GetVoice(int voiceIndex) const;
+		int								GetChannelVoice(int channel) const;
+		const std::vector<VoiceChange>& GetChanges() const;
+
+		// Utilities
+		void Initialize(int voiceCount, int channelCount);
+		void Clear();
+		int	 Find(int effectID, const Vector3* origin, float matchRadius) const;
+		int	 Play(const VirtualVoice& voice, const Vector3& listenerPos);
+		int	 Bind(int voiceIndex);
+		void Unbind(int voiceIndex);
+		void Release(int voiceIndex);
+		void Update(const Vector3& listenerPos, float deltaTime);
+
+		static float GetAudibility(const VirtualVoice& voice, const Vector3& listenerPos);
+
+	private:
+		// Helpers
+		float GetScore(int voiceIndex) const;
+		int	  GetFreeChannel() const;
+		void  AssignChannel(int voiceIndex, int channel);
+	};
+
+	bool TestVoiceManager();
+}
@@ -10,29 +10,25 @@
 #include "Game/Lara/lara.h"
 #include "Game/room.h"
 #include "Game/Setup.h"
+#include "Sound/BassSoundBackend.h"
+#include "Sound/SoftwareSoundBackend.h"
+#include "Sound/VoiceManager.h"
+#include "Specific/clock.h"
 #include "Specific/configuration.h"
 #include "Specific/level.h"
 #include "Specific/trutils.h"
 #include "Specific/winmain.h"
 
-HSAMPLE BASS_SamplePointer[SOUND_MAX_SAMPLES];
-HSTREAM BASS_3D_Mixdown;
-HFX     BASS_FXHandler[(int)SoundFilter::Count];
+using namespace TEN::Sound;
 
-HMODULE ADPCMLibrary = NULL; // Temporary hack for unexpected ADPCM codec unload on Win11 systems.
+float SampleDuration[SOUND_MAX_SAMPLES]; // In seconds, used to end virtual voices.
 
-SoundEffectSlot SoundSlot[SOUND_MAX_CHANNELS];
-SoundTrackSlot  SoundtrackSlot[(int)SoundTrackType::Count];
+HMODULE ADPCMLibrary = NULL; // Temporary hack for unexpected ADPCM codec unload on Win11 systems.
 
-const BASS_BFX_FREEVERB BASS_ReverbTypes[(int)ReverbType::Count] =    // Reverb presets
+SoundTrackSlot SoundtrackSlot[(int)SoundTrackType::Count];
+VoiceManager   SoundVoices;
 
-{ // Dry Mix | Wet Mix |  Size   |  Damp   |  Width  |  Mode  | Channel
-  {  1.0f,     0.20f,     0.05f,    0.90f,    0.7f,     0,      -1     },	// 0 = Outside
-  {  1.0f,     0.20f,     0.35f,    0.15f,    0.8f,     0,      -1     },	// 1 = Small room
-  {  1.0f,     0.25f,     0.55f,    0.20f,    1.0f,     0,      -1     },	// 2 = Medium room
-  {  1.0f,     0.25f,     0.80f,    0.50f,    1.0f,     0,      -1     },	// 3 = Large room
-  {  1.0f,     0.25f,     0.90f,    1.00f,    1.0f,     0,      -1     }	// 4 = Pipe
-};
+std::unique_ptr<SoundBackend> SoundEffectBackend = nullptr;
 
 const  std::string TRACKS_PATH = "Audio/";
 static std::string FullAudioDirectory;
@@ -91,62 +87,38 @@ bool LoadSample(char* pointer, int compSize, int uncompSize, int index)
 		return false;
 	}
 
-	// Paranoid (c) TeslaRus
-	// Try to free sample before allocating new one.
-	Sound_FreeSample(index);
-
 	BASS_SAMPLE info;
 	BASS_SampleGetInfo(sample, &info);
-	int finalLength = info.length + 44;	// uncompSize is invalid after 16->32 bit conversion
 
 	if (info.freq != 22050 || info.chans != 1)
 	{
 		TENLog("Wrong sample parameters, must be 22050 Hz Mono", LogLevel::Error);
+		BASS_SampleFree(sample);
 		return false;
 	}
 
-	// Generate RIFF/WAV header to simplify loading sample data to stream. In case if RIFF/WAV header
-	// exists, stream could be completely created just by calling BASS_StreamCreateFile().
-	char* uncompBuffer = new char[finalLength];
-	ZeroMemory(uncompBuffer, finalLength);
-	memcpy(uncompBuffer, "RIFF\0\0\0\0WAVEfmt \20\0\0\0", 20);
-	memcpy(uncompBuffer + 36, "data\0\0\0\0", 8);
-
-	WAVEFORMATEX *wf = (WAVEFORMATEX*)(uncompBuffer + 20);
-
-	wf->wFormatTag = 3;
-	wf->nChannels = info.chans;
-	wf->wBitsPerSample = 32;
-	wf->nSamplesPerSec = info.freq;
-	wf->nBlockAlign = wf->nChannels * wf->wBitsPerSample / 8;
-	wf->nAvgBytesPerSec = wf->nSamplesPerSec * wf->nBlockAlign;
-
-	// Copy raw PCM data from temporary sample buffer to actual buffer which will be used by engine.
-	BASS_SampleGetData(sample, uncompBuffer + 44);
+	// Copy raw PCM data from temporary sample buffer, so it can be handed to sound backend.
+	auto data = std::vector<float>(info.length / sizeof(float));
+	BASS_SampleGetData(sample, data.data());
 	BASS_SampleFree(sample);
 
 	// Cut off trailing silence from samples to prevent gaps in looped playback
-	int cleanLength = info.length;
-	for (DWORD i = 4; i < info.length; i += 4)
+	int cleanLength = (int)data.size();
+	for (int i = (int)data.size() - 1; i > 0; i--)
 	{
-		float *currentSample = reinterpret_cast<float*>(uncompBuffer + finalLength - i);
-		if (*currentSample > SOUND_32BIT_SILENCE_LEVEL || *currentSample < -SOUND_32BIT_SILENCE_LEVEL)
+		if (data[i] > SOUND_32BIT_SILENCE_LEVEL || data[i] < -SOUND_32BIT_SILENCE_LEVEL)
 		{
-			int alignment = i % wf->nBlockAlign;
-			cleanLength -= (i - alignment);
+			cleanLength = i + 1;
 			break;
 		}
 	}
 
-	// Put data size to header
-	*(DWORD*)(uncompBuffer + 4) = cleanLength + 44 - 8;
-	*(DWORD*)(uncompBuffer + 40) = cleanLength;
+	SampleDuration[index] = (float)cleanLength / (float)info.freq;
 
-	// Create actual sample
-	BASS_SamplePointer[index] = BASS_SampleLoad(true, uncompBuffer, 0, cleanLength + 44, 65535, SOUND_SAMPLE_FLAGS | BASS_SAMPLE_3D);
-	delete[] uncompBuffer;
+	if (SoundEffectBackend == nullptr)
+		return false;
 
-	return true;
+	return SoundEffectBackend->LoadSample(index, data.data(), cleanLength, info.freq);
 }
 
 bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float pitchMultiplier, float gainMultiplier)
@@ -157,7 +129,7 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 	if (effectID >= g_Level.SoundMap.size())
 		return false;
 
-	if (BASS_GetDevice() == -1)
+	if (SoundEffectBackend == nullptr)
 		return false;
 
 	if (condition != SoundEnvironment::Always)
@@ -192,17 +164,10 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 		return false;
 	}
 
-	// Assign common sample flags.
-	DWORD sampleFlags = SOUND_SAMPLE_FLAGS;
-
 	// Effect's chance to play.
 	if ((sampleInfo->Randomness) && ((GetRandomControl() & UCHAR_MAX) > sampleInfo->Randomness))
 		return false;
 
-	// Apply 3D attrib only to sound with position property
-	if (position)
-		sampleFlags |= BASS_SAMPLE_3D;
-
 	// Set & randomize volume (if needed)
 	float gain = (static_cast<float>(sampleInfo->Volume) / UCHAR_MAX) * std::clamp(gainMultiplier, SOUND_MIN_PARAM_MULTIPLIER, SOUND_MAX_PARAM_MULTIPLIER);
 	if ((sampleInfo->Flags & SOUND_FLAG_RND_GAIN))
@@ -226,8 +191,9 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 	// Get final volume of a sound.
 	float volume = Sound_Attenuate(gain, distance, radius);
 
-	// Get existing index, if any, of sound which is playing.
-	int existingChannel = Sound_EffectIsPlaying(effectID, position);
+	// Get existing index, if any, of sound which is playing. Virtual voices count as playing.
+	int existingVoice = Sound_EffectIsPlaying(effectID, position);
+	auto origin = position ? position->Position.ToVector3() : SOUND_OMNIPRESENT_ORIGIN;
 
 	// Select behaviour based on effect playback type (bytes 0-1 of flags field)
 	auto playType = (SoundPlayMode)(sampleInfo->Flags & 3);
@@ -237,23 +203,33 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 		break;
 
 	case SoundPlayMode::Wait:
-		if (existingChannel != SOUND_NO_CHANNEL) // Don't play until stopped
+		if (existingVoice != SOUND_NO_CHANNEL) // Don't play until stopped
 			return false;
 		break;
 
 	case SoundPlayMode::Restart:
-		if (existingChannel != SOUND_NO_CHANNEL) // Stop existing and continue
-			Sound_FreeSlot(existingChannel, SOUND_XFADETIME_CUTSOUND); 
+		if (existingVoice != SOUND_NO_CHANNEL) // Stop existing and continue
+			Sound_FreeVoice(existingVoice, SOUND_XFADETIME_CUTSOUND);
 		break;
 
 	case SoundPlayMode::Looped:
-		if (existingChannel != SOUND_NO_CHANNEL) // Just update parameters and return, if already playing
+		if (existingVoice != SOUND_NO_CHANNEL) // Just update parameters and return, if already playing
 		{
-			Sound_UpdateEffectPosition(existingChannel, position);
-			Sound_UpdateEffectAttributes(existingChannel, pitch, volume);
+			auto& voice = SoundVoices.GetVoice(existingVoice);
+			voice.Origin = origin;
+			voice.Pitch = pitch;
+			voice.IsRefreshed = true;
+
+			if (voice.Channel != NO_CHANNEL)
+			{
+				if (position)
+					Sound_UpdateEffectPosition(voice.Channel, origin);
+
+				Sound_UpdateEffectAttributes(voice.Channel, pitch, volume);
+			}
+
 			return false;
 		}
-		sampleFlags |= BASS_SAMPLE_LOOP;
 		break;
 	}
 
@@ -265,47 +241,33 @@ bool SoundEffect(int effectID, Pose* position, SoundEnvironment condition, float
 	else
 		sampleToPlay = sampleInfo->Number + (int)((GetRandomControl() * numSamples) >> 15);
 
-	// Get free channel to play sample
-	int freeSlot = Sound_GetFreeSlot();
-	if (freeSlot == SOUND_NO_CHANNEL)
+	// Register virtual voice. No device calls are made unless it is audible enough to get a channel;
+	// otherwise it plays virtually and may be promoted by Sound_UpdateScene() later.
+	auto voice = VirtualVoice{};
+	voice.IsOmnipresent = (position == nullptr);
+	voice.IsLooped = (playType == SoundPlayMode::Looped);
+	voice.EffectID = effectID;
+	voice.SampleIndex = sampleToPlay;
+	voice.Origin = origin;
+	voice.Gain = gain;
+	voice.Pitch = pitch;
+	voice.Radius = radius;
+	voice.Priority = position ? 1.0f : SOUND_PRIORITY_OMNIPRESENT;
+	voice.Duration = SampleDuration[sampleToPlay];
+
+	int voiceIndex = SoundVoices.Play(voice, Camera.mikePos.ToVector3());
+	if (voiceIndex == NO_VOICE)
 	{
-		TENLog("No free channel slot available!", LogLevel::Warning);
+		TENLog("No free sound voice available!", LogLevel::Warning);
 		return false;
 	}
 
-	// Create sample's stream and reset buffer back to normal value.
-	HSTREAM channel = BASS_SampleGetChannel(BASS_SamplePointer[sampleToPlay], true);
-
-	if (Sound_CheckBASSError("Trying to create channel for sample %d", false, sampleToPlay))
-		return false;
-
-	// Finally ready to play sound, assign it to sound slot.
-	SoundSlot[freeSlot].State = SoundState::Idle;
-	SoundSlot[freeSlot].EffectID = effectID;
-	SoundSlot[freeSlot].Channel = channel;
-	SoundSlot[freeSlot].Gain = gain;
-	SoundSlot[freeSlot].Origin = position ? Vector3(position->Position.x, position->Position.y, position->Position.z) : SOUND_OMNIPRESENT_ORIGIN;
-
-	if (Sound_CheckBASSError("Applying pitch/gain attribs on channel %x, sample %d", false, channel, sampleToPlay))
-		return false;
-
-	// Set looped flag, if necessary
-	if (playType == SoundPlayMode::Looped)
-		BASS_ChannelFlags(channel, BASS_SAMPLE_LOOP, BASS_SAMPLE_LOOP);
-
-	// Play channel
-	BASS_ChannelPlay(channel, false);
-
-	if (Sound_CheckBASSError("Queuing channel %x on sample mixer", false, freeSlot))
-		return false;
-
-	// Set attributes
-	BASS_ChannelSet3DAttributes(channel, position ? BASS_3DMODE_NORMAL : BASS_3DMODE_OFF, SOUND_MAXVOL_RADIUS, radius, 360, 360, 0.0f);
-	Sound_UpdateEffectPosition(freeSlot, position, true);
-	Sound_UpdateEffectAttributes(freeSlot, pitch, volume);
-
-	if (Sound_CheckBASSError("Applying 3D attribs on channel %x, sound %d", false, channel, effectID))
+	int channelIndex = SoundVoices.Bind(voiceIndex);
+	if (channelIndex != NO_CHANNEL && !Sound_StartVoice(voiceIndex, channelIndex))
+	{
+		Sound_FreeVoice(voiceIndex);
 		return false;
+	}
 
 	return true;
 }
@@ -318,10 +280,10 @@ void PauseAllSounds(SoundPauseMode mode)
 		return;
 	}
 
-	for (const auto& slot : SoundSlot)
+	if (SoundEffectBackend != nullptr)
 	{
-		if ((slot.Channel != NULL) && (BASS_ChannelIsActive(slot.Channel) == BASS_ACTIVE_PLAYING))
-			BASS_ChannelPause(slot.Channel);
+		for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
+			SoundEffectBackend->PauseChannel(i);
 	}
 
 	for (int i = 0; i < (int)SoundTrackType::Count; i++)
@@ -349,19 +311,20 @@ void ResumeAllSounds(SoundPauseMode mode)
 	if (mode == SoundPauseMode::Global)
 		return;
 
-	for (const auto& slot : SoundSlot)
+	if (SoundEffectBackend != nullptr)
 	{
-		if ((slot.Channel != NULL) && (BASS_ChannelIsActive(slot.Channel) == BASS_ACTIVE_PAUSED))
-			BASS_ChannelStart(slot.Channel);
+		for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
+			SoundEffectBackend->ResumeChannel(i);
 	}
 }
 
 void StopSoundEffect(short effectID)
 {
-	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
+	for (int i = 0; i < SoundVoices.GetVoiceCount(); i++)
 	{
-		if (SoundSlot[i].Channel != NULL && SoundSlot[i].EffectID == effectID && BASS_ChannelIsActive(SoundSlot[i].Channel) == BASS_ACTIVE_PLAYING)
-			Sound_FreeSlot(i, SOUND_XFADETIME_CUTSOUND);
+		const auto& voice = SoundVoices.GetVoice(i);
+		if (voice.IsActive && voice.EffectID == effectID)
+			Sound_FreeVoice(i, SOUND_XFADETIME_CUTSOUND);
 	}
 }
 
@@ -370,7 +333,7 @@ void StopAllSounds()
 	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
 		Sound_FreeSlot(i, SOUND_XFADETIME_CUTSOUND);
 
-	ZeroMemory(SoundSlot, (sizeof(SoundEffectSlot) * SOUND_MAX_CHANNELS));
+	SoundVoices.Clear();
 }
 
 void FreeSamples()
@@ -677,41 +640,8 @@ static void CALLBACK Sound_FinishOneshotTrack(HSYNC handle, DWORD channel, DWORD
 
 void Sound_FreeSample(int index)
 {
-	if (BASS_SamplePointer[index] != NULL)
-	{
-		BASS_SampleFree(BASS_SamplePointer[index]);
-		BASS_SamplePointer[index] = NULL;
-	}
-}
-
-// Get first free (non-playing) sound slot.
-// If no free slots found, now try to hijack slot which is as far from listener as possible
-int Sound_GetFreeSlot()
-{
-	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
-	{
-		if (SoundSlot[i].Channel == NULL || !BASS_ChannelIsActive(SoundSlot[i].Channel))
-			return i;
-	}
-
-	// No free slots, hijack now.
-
-	float minDistance = 0;
-	int farSlot = SOUND_NO_CHANNEL;
-
-	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
-	{
-		float distance = Vector3(SoundSlot[i].Origin - Vector3(Camera.mikePos.x, Camera.mikePos.y, Camera.mikePos.z)).Length();
-		if (distance > minDistance)
-		{
-			minDistance = distance;
-			farSlot = i;
-		}
-	}
-
-	TENLog("Hijacking sound effect slot " + std::to_string(farSlot), LogLevel::Info);
-	Sound_FreeSlot(farSlot, SOUND_XFADETIME_HIJACKSOUND);
-	return farSlot;
+	if (SoundEffectBackend != nullptr)
+		SoundEffectBackend->FreeSample(index);
 }
 
 int Sound_TrackIsPlaying(const std::string& fileName)
@@ -733,43 +663,18 @@ int Sound_TrackIsPlaying(const std::string& fileName)
 	return false;
 }
 
-// Returns slot ID in which effect is playing, if found. If not found, returns -1.
+// Returns voice ID in which effect is playing, if found. If not found, returns -1.
 // We use origin position as a reference, because in original TRs it's not possible to clearly
 // identify what's the source of the producing effect.
 
 int Sound_EffectIsPlaying(int effectID, Pose *position)
 {
-	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
-	{
-		if (SoundSlot[i].EffectID == effectID)
-		{
-			// Free channel.
-			if (SoundSlot[i].Channel == NULL)
-				continue;
-
-			if (BASS_ChannelIsActive(SoundSlot[i].Channel))
-			{
-				// Only check position on 3D samples. 2D samples stop immediately.
-
-				BASS_CHANNELINFO info;
-				BASS_ChannelGetInfo(SoundSlot[i].Channel, &info);
-				if (!(info.flags & BASS_SAMPLE_3D) || !position)
-					return i;
-
-				// Check if effect origin is equal OR in nearest possible hearing range.
-
-				auto origin = Vector3(position->Position.x, position->Position.y, position->Position.z);
-				if (Vector3::Distance(origin, SoundSlot[i].Origin) < SOUND_MAXVOL_RADIUS)
-					return i;
-			}
-			else
-			{
-				SoundSlot[i].Channel = NULL; // WTF, let's clean this up
-			}
-		}
-	}
+	if (!position)
+		return SoundVoices.Find(effectID, nullptr, SOUND_MAXVOL_RADIUS);
 
-	return SOUND_NO_CHANNEL;
+	// Check if effect origin is equal OR in nearest possible hearing range.
+	auto origin = position->Position.ToVector3();
+	return SoundVoices.Find(effectID, &origin, SOUND_MAXVOL_RADIUS);
 }
 
 // Gets the distance to the source.
@@ -797,48 +702,69 @@ float Sound_Attenuate(float gain, float distance, float radius)
 // Stop and free desired sound slot.
 void Sound_FreeSlot(int index, unsigned int fadeout)
 {
-	if (index >= SOUND_MAX_CHANNELS || index < 0)
+	if (index >= SOUND_MAX_CHANNELS || index < 0 || SoundEffectBackend == nullptr)
 		return;
 
-	if (SoundSlot[index].Channel != NULL && BASS_ChannelIsActive(SoundSlot[index].Channel))
-	{
-		if (fadeout > 0)
-			BASS_ChannelSlideAttribute(SoundSlot[index].Channel, BASS_ATTRIB_VOL, -1.0f, fadeout);
-		else
-			BASS_ChannelStop(SoundSlot[index].Channel);
-	}
+	SoundEffectBackend->StopChannel(index, fadeout);
+}
+
+// Stop desired voice and free its channel, if it is bound to one.
+void Sound_FreeVoice(int index, unsigned int fadeout)
+{
+	if (index >= SoundVoices.GetVoiceCount() || index < 0)
+		return;
 
-	SoundSlot[index].Channel = NULL;
-	SoundSlot[index].State = SoundState::Idle;
-	SoundSlot[index].EffectID = SOUND_NO_CHANNEL;
+	int channelIndex = SoundVoices.GetVoice(index).Channel;
+	if (channelIndex != NO_CHANNEL)
+		Sound_FreeSlot(channelIndex, fadeout);
+
+	SoundVoices.Release(index);
 }
 
-// Update sound position in a level.
-bool Sound_UpdateEffectPosition(int index, Pose *position, bool force)
+// Create channel for voice which was just bound to sound slot and start it from voice's current time,
+// so that promoted voice continues where it would be if it had been playing all along.
+bool Sound_StartVoice(int voiceIndex, int index)
 {
-	if (index >= SOUND_MAX_CHANNELS || index < 0)
+	auto& voice = SoundVoices.GetVoice(voiceIndex);
+
+	// Slot may still hold channel of voice which was displaced from it.
+	Sound_FreeSlot(index, SOUND_XFADETIME_HIJACKSOUND);
+
+	if (SoundEffectBackend == nullptr)
+	{
+		SoundVoices.Unbind(voiceIndex);
 		return false;
+	}
+
+	float distance = voice.IsOmnipresent ? 0.0f : Sound_DistanceToListener(voice.Origin);
 
-	if (position)
+	auto params = SoundChannelParams{};
+	params.SampleIndex = voice.SampleIndex;
+	params.IsLooped = voice.IsLooped;
+	params.Is3D = !voice.IsOmnipresent;
+	params.Position = voice.Origin;
+	params.MinDistance = SOUND_MAXVOL_RADIUS;
+	params.MaxDistance = voice.Radius;
+	params.StartTime = voice.Time;
+	params.Pitch = voice.Pitch;
+	params.Gain = Sound_Attenuate(voice.Gain, distance, voice.Radius);
+
+	if (!SoundEffectBackend->StartChannel(index, params))
 	{
-		BASS_CHANNELINFO info;
-		BASS_ChannelGetInfo(SoundSlot[index].Channel, &info);
-		if (info.flags & BASS_SAMPLE_3D)
-		{
-			SoundSlot[index].Origin.x = position->Position.x;
-			SoundSlot[index].Origin.y = position->Position.y;
-			SoundSlot[index].Origin.z = position->Position.z;
-
-			auto pos = BASS_3DVECTOR(position->Position.x, position->Position.y, position->Position.z);
-			auto rot = BASS_3DVECTOR(position->Orientation.x, position->Orientation.y, position->Orientation.z);
-			BASS_ChannelSet3DPosition(SoundSlot[index].Channel, &pos, &rot, NULL);
-			BASS_Apply3D();
-		}
+		SoundVoices.Unbind(voiceIndex);
+		return false;
 	}
 
-	// Reset activity flag, important for looped samples
-	if (BASS_ChannelIsActive(SoundSlot[index].Channel))
-		SoundSlot[index].State = SoundState::Idle;
+	return true;
+}
+
+// Update sound position in a level. Positions are applied to device once per frame in Sound_UpdateScene().
+bool Sound_UpdateEffectPosition(int index, const Vector3& origin)
+{
+	if (index >= SOUND_MAX_CHANNELS || index < 0 || SoundEffectBackend == nullptr)
+		return false;
+
+	SoundEffectBackend->SetChannelPosition(index, origin);
 
 	return true;
 }
@@ -846,20 +772,19 @@ bool Sound_UpdateEffectPosition(int index, Pose *position, bool force)
 // Update gain and pitch.
 bool  Sound_UpdateEffectAttributes(int index, float pitch, float gain)
 {
-	if (index >= SOUND_MAX_CHANNELS || index < 0)
+	if (index >= SOUND_MAX_CHANNELS || index < 0 || SoundEffectBackend == nullptr)
 		return false;
 
-	BASS_ChannelSetAttribute(SoundSlot[index].Channel, BASS_ATTRIB_FREQ, 22050.0f * pitch);
-	BASS_ChannelSetAttribute(SoundSlot[index].Channel, BASS_ATTRIB_VOL, gain);
+	SoundEffectBackend->SetChannelAttributes(index, pitch, gain);
 
 	return true;
 }
 
 // Update whole sound scene in a level.
-// Must be called every frame to update camera position and 3D parameters.
-void Sound_UpdateScene()
+// Must be called every frame to update camera position and 3D parameters. Delta time is real time elapsed since previous call.
+void Sound_UpdateScene(float deltaTime)
 {
-	if (!g_Configuration.EnableSound)
+	if (!g_Configuration.EnableSound || SoundEffectBackend == nullptr)
 		return;
 
 	// Apply environmental effects
@@ -870,66 +795,73 @@ void Sound_UpdateScene()
 	if (currentReverb == -1 || roomReverb != currentReverb)
 	{
 		currentReverb = roomReverb;
-		if (currentReverb < (int)ReverbType::Count)
-			BASS_FXSetParameters(BASS_FXHandler[(int)SoundFilter::Reverb], &BASS_ReverbTypes[(int)currentReverb]);
+		SoundEffectBackend->SetReverb(currentReverb);
 	}
 
+	// Release voices whose channels have finished playing.
 	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
 	{
-		if ((SoundSlot[i].Channel != NULL) && (BASS_ChannelIsActive(SoundSlot[i].Channel) == BASS_ACTIVE_PLAYING))
-		{
-			SampleInfo* sampleInfo = &g_Level.SoundDetails[g_Level.SoundMap[SoundSlot[i].EffectID]];
+		int voiceIndex = SoundVoices.GetChannelVoice(i);
+		if (voiceIndex == NO_VOICE)
+			continue;
 
-			// Stop and clean up sounds which were in ending state in previous frame.
-			// In case sound is looping, make it ending unless they are re-fired in next frame.
+		if (!SoundEffectBackend->IsChannelActive(i))
+		{
+			SoundEffectBackend->StopChannel(i, 0);
+			SoundVoices.Release(voiceIndex);
+		}
+	}
 
-			if (SoundSlot[i].State == SoundState::Ending)
-			{
-				SoundSlot[i].State = SoundState::Ended;
-				Sound_FreeSlot(i, SOUND_XFADETIME_CUTSOUND);
-				continue;
-			}
-			else if ((SoundPlayMode)(sampleInfo->Flags & 3) == SoundPlayMode::Looped)
-				SoundSlot[i].State = SoundState::Ending;
+	// Rank all voices by audibility and move channels to most audible ones.
+	// Looped voices which weren't re-fired since previous frame are stopped here as well.
+	SoundVoices.Update(Camera.mikePos.ToVector3(), deltaTime);
 
-			// Calculate attenuation and clean up sounds which are out of listener range (only for 3D sounds).
+	for (const auto& change : SoundVoices.GetChanges())
+	{
+		switch (change.Type)
+		{
+		case VoiceChangeType::Stop:
+			Sound_FreeSlot(change.Channel, SOUND_XFADETIME_CUTSOUND);
+			break;
 
-			if (SoundSlot[i].Origin != SOUND_OMNIPRESENT_ORIGIN)
-			{
-				float radius = (float)(sampleInfo->Radius) * 1024.0f;
-				float distance = Sound_DistanceToListener(SoundSlot[i].Origin);
+		case VoiceChangeType::Demote:
+			Sound_FreeSlot(change.Channel, SOUND_XFADETIME_HIJACKSOUND);
+			break;
 
-				if (distance > radius)
-				{
-					Sound_FreeSlot(i);
-					continue;
-				}
-				else
-					BASS_ChannelSetAttribute(SoundSlot[i].Channel, BASS_ATTRIB_VOL, Sound_Attenuate(SoundSlot[i].Gain, distance, radius));
-			}
+		case VoiceChangeType::Promote:
+			Sound_StartVoice(change.VoiceIndex, change.Channel);
+			break;
 		}
 	}
 
+	// Calculate attenuation of bound 3D voices.
+	for (int i = 0; i < SOUND_MAX_CHANNELS; i++)
+	{
+		int voiceIndex = SoundVoices.GetChannelVoice(i);
+		if (voiceIndex == NO_VOICE)
+			continue;
+
+		const auto& voice = SoundVoices.GetVoice(voiceIndex);
+		if (voice.IsOmnipresent)
+			continue;
+
+		float distance = Sound_DistanceToListener(voice.Origin);
+		SoundEffectBackend->SetChannelGain(i, Sound_Attenuate(voice.Gain, distance, voice.Radius));
+	}
+
 	// Apply current listener position.
 
 	Vector3 at = Vector3(Camera.target.x, Camera.target.y, Camera.target.z) -
 		Vector3(Camera.mikePos.x, Camera.mikePos.y, Camera.mikePos.z);
 	at.Normalize();
-	auto mikePos = BASS_3DVECTOR(					// Pos
-		Camera.mikePos.x,
-		Camera.mikePos.y,
-		Camera.mikePos.z);
-	auto laraVel = BASS_3DVECTOR(					// Vel
-		Lara.Context.WaterCurrentPull.x,
-		Lara.Context.WaterCurrentPull.y,
-		Lara.Context.WaterCurrentPull.z);
-	auto atVec = BASS_3DVECTOR(at.x, at.y, at.z);	// At
-	auto upVec = BASS_3DVECTOR(0.0f, 1.0f, 0.0f);	// Up
-	BASS_Set3DPosition(&mikePos,
-					   &laraVel,
-					   &atVec,
-					   &upVec);
-	BASS_Apply3D();
+	SoundEffectBackend->SetListener(
+		Camera.mikePos.ToVector3(),
+		Lara.Context.WaterCurrentPull.ToVector3(),
+		at,
+		Vector3::UnitY);
+
+	// Let backend apply all changes made during this frame. Software mixer renders as much audio as time elapsed.
+	SoundEffectBackend->Update(deltaTime);
 }
 
 // Initialize BASS engine and also prepare all sound data.
@@ -940,13 +872,17 @@ void Sound_Init(const std::string& gameDirectory)
 	FullAudioDirectory = gameDirectory + TRACKS_PATH;
 	EnumerateLegacyTracks();
 
+	// Voices are always initialized, so that voice queries are valid even if device fails to start.
+	SoundVoices.Initialize(VOICE_COUNT_MAX, SOUND_MAX_CHANNELS);
+
 	if (!g_Configuration.EnableSound)
 		return;
 	
 	// HACK: Manually force-load ADPCM codec, because on Win11 systems it may suddenly unload otherwise.
 	ADPCMLibrary = LoadLibrary("msadp32.acm");
 
-	BASS_Init(g_Configuration.SoundDevice, 44100, BASS_DEVICE_3D, WindowsHandle, NULL);
+	// Headless mode uses BASS "no sound" device, which is still enough to decode samples and streams.
+	BASS_Init(HeadlessAudioMode ? 0 : g_Configuration.SoundDevice, 44100, BASS_DEVICE_3D, WindowsHandle, NULL);
 	if (Sound_CheckBASSError("Initializing BASS sound device", true))
 		return;
 
@@ -955,47 +891,19 @@ void Sound_Init(const std::string& gameDirectory)
 	if (Sound_CheckBASSError("Initializing FX plugin", true))
 		return;
 
-	// Set 3D world parameters.
-	// Rolloff is lessened since we have own attenuation implementation.
-	BASS_Set3DFactors(SOUND_BASS_UNITS, 1.5f, 0.5f);	
-	BASS_SetConfig(BASS_CONFIG_3DALGORITHM, BASS_3DALG_FULL);
-
-	// Set minimum latency and 2 threads for updating.
-	// Most of modern PCs already have multi-core CPUs, so why not parallelize updating?
-	BASS_SetConfig(BASS_CONFIG_UPDATETHREADS, 2);
-	BASS_SetConfig(BASS_CONFIG_UPDATEPERIOD, 10);
-
-	// Create 3D mixdown channel and make it play forever.
-	// For realtime mixer channels, we need minimum buffer latency. It shouldn't affect reliability.
-	BASS_SetConfig(BASS_CONFIG_BUFFER, 40);
-	BASS_3D_Mixdown = BASS_StreamCreate(44100, 2, BASS_SAMPLE_FLOAT, STREAMPROC_DEVICE_3D, NULL);
-	BASS_ChannelPlay(BASS_3D_Mixdown, false);
-
-	// Reset buffer back to normal value.
-	BASS_SetConfig(BASS_CONFIG_BUFFER, 300);
-
-	if (Sound_CheckBASSError("Starting 3D mixdown", true))
-		return;
-
-	// Initialize channels and tracks array
-	ZeroMemory(SoundSlot, (sizeof(SoundEffectSlot) * SOUND_MAX_CHANNELS));
-
-	// Attach reverb effect to 3D channel
- 	BASS_FXHandler[(int)SoundFilter::Reverb] = BASS_ChannelSetFX(BASS_3D_Mixdown, BASS_FX_BFX_FREEVERB, 0);
-	BASS_FXSetParameters(BASS_FXHandler[(int)SoundFilter::Reverb], &BASS_ReverbTypes[(int)ReverbType::Outside]);
-
-	if (Sound_CheckBASSError("Attaching environmental FX", true))
-		return;
-
-	// Apply slight compression to 3D channel
-	BASS_FXHandler[(int)SoundFilter::Compressor] = BASS_ChannelSetFX(BASS_3D_Mixdown, BASS_FX_BFX_COMPRESSOR2, 1);
-	auto comp = BASS_BFX_COMPRESSOR2{ 4.0f, -18.0f, 1.5f, 10.0f, 100.0f, -1 };
-	BASS_FXSetParameters(BASS_FXHandler[(int)SoundFilter::Compressor], &comp);
-
-	if (Sound_CheckBASSError("Attaching compressor", true))
-		return;
+	// Sound effects are played by separate backend, soundtracks always go through BASS.
+	if (HeadlessAudioMode)
+	{
+		TENLog("Using software sound mixer for headless mode.", LogLevel::Info);
+		SoundEffectBackend = std::make_unique<SoftwareSoundBackend>();
+	}
+	else
+	{
+		SoundEffectBackend = std::make_unique<BassSoundBackend>();
+	}
 
-	return;
+	if (!SoundEffectBackend->Initialize(SOUND_MAX_SAMPLES, SOUND_MAX_CHANNELS))
+		SoundEffectBackend.reset();
 }
 
 // Stop all sounds and streams, if any, unplug all channels from the mixer and unload BASS engine.
@@ -1005,6 +913,8 @@ void Sound_DeInit()
 	if (!g_Configuration.EnableSound)
 		return;
 
+	SoundEffectBackend.reset();
+
 	TENLog("Shutting down BASS...", LogLevel::Info);
 	BASS_Free();
 
@@ -1059,24 +969,165 @@ int GetShatterSound(int shatterID)
 		return SFX_TR4_SMASH_ROCK;
 }
 
-void PlaySoundSources()
+enum class SoundSourcePlayMode
+{
+	Always,
+	BaseRoom,
+	FlipRoom
+};
+
+// Sound source with flipmap filtering and radius resolved at grid build time.
+struct SoundSourceEntry
+{
+	int					SourceIndex = 0;
+	int					FlipGroup	= 0;
+	SoundSourcePlayMode PlayMode	= SoundSourcePlayMode::Always;
+	float				Radius		= 0.0f;
+};
+
+// Coarse XZ grid over sound sources. Every source is listed in all cells its radius touches,
+// so only sources listed in listener's cell can be heard.
+constexpr auto SOUND_SOURCE_CELL_SIZE = BLOCK(8);
+
+static std::vector<SoundSourceEntry> SoundSourceEntries		 = {}; // Grouped by cell.
+static std::vector<int>				 SoundSourceCellOffsets	 = {}; // First entry of each cell, plus end of last one.
+static Vector2i						 SoundSourceGridOrigin	 = Vector2i::Zero;
+static Vector2i						 SoundSourceGridSize	 = Vector2i::Zero;
+static bool							 SoundSourceGridIsDirty = true;
+
+void InvalidateSoundSources()
+{
+	SoundSourceGridIsDirty = true;
+}
+
+static void BuildSoundSourceGrid()
 {
-	static constexpr int PLAY_ALWAYS    = 0x8000;
 	static constexpr int PLAY_BASE_ROOM = 0x4000;
 	static constexpr int PLAY_FLIP_ROOM = 0x2000;
 
-	for (size_t i = 0; i < g_Level.SoundSources.size(); i++)
+	SoundSourceGridIsDirty = false;
+	SoundSourceEntries.clear();
+	SoundSourceCellOffsets.clear();
+
+	auto sources = std::vector<SoundSourceEntry>{};
+	sources.reserve(g_Level.SoundSources.size());
+
+	for (int i = 0; i < g_Level.SoundSources.size(); i++)
 	{
 		const auto& sound = g_Level.SoundSources[i];
 
 		int group = sound.Flags & 0x1FFF;
-
 		if (group >= MAX_FLIPMAP)
 			continue;
 
-		if (!FlipStats[group] && (sound.Flags & PLAY_FLIP_ROOM))
+		// Sources flagged for both rooms never play.
+		bool isBaseRoom = (sound.Flags & PLAY_BASE_ROOM);
+		bool isFlipRoom = (sound.Flags & PLAY_FLIP_ROOM);
+		if (isBaseRoom && isFlipRoom)
+			continue;
+
+		if (sound.SoundID < 0 || sound.SoundID >= g_Level.SoundMap.size())
+			continue;
+
+		int sampleIndex = g_Level.SoundMap[sound.SoundID];
+		if (sampleIndex < 0)
 			continue;
-		else if (FlipStats[group] && (sound.Flags & PLAY_BASE_ROOM))
+
+		auto entry = SoundSourceEntry{};
+		entry.SourceIndex = i;
+		entry.FlipGroup = group;
+		entry.PlayMode = isFlipRoom ? SoundSourcePlayMode::FlipRoom : (isBaseRoom ? SoundSourcePlayMode::BaseRoom : SoundSourcePlayMode::Always);
+		entry.Radius = (float)g_Level.SoundDetails[sampleIndex].Radius * BLOCK(1);
+		sources.push_back(entry);
+	}
+
+	if (sources.empty())
+		return;
+
+	auto getCellRange = [](const SoundSourceEntry& entry, Vector2i& minCell, Vector2i& maxCell)
+	{
+		const auto& pos = g_Level.SoundSources[entry.SourceIndex].Position;
+		minCell = Vector2i((pos.x - (int)entry.Radius - SoundSourceGridOrigin.x) / SOUND_SOURCE_CELL_SIZE,
+						   (pos.z - (int)entry.Radius - SoundSourceGridOrigin.y) / SOUND_SOURCE_CELL_SIZE);
+		maxCell = Vector2i((pos.x + (int)entry.Radius - SoundSourceGridOrigin.x) / SOUND_SOURCE_CELL_SIZE,
+						   (pos.z + (int)entry.Radius - SoundSourceGridOrigin.y) / SOUND_SOURCE_CELL_SIZE);
+	};
+
+	// Grid spans bounds of all source radii.
+	auto minPos = Vector2i(INT_MAX, INT_MAX);
+	auto maxPos = Vector2i(INT_MIN, INT_MIN);
+	for (const auto& entry : sources)
+	{
+		const auto& pos = g_Level.SoundSources[entry.SourceIndex].Position;
+		minPos = Vector2i(std::min(minPos.x, pos.x - (int)entry.Radius), std::min(minPos.y, pos.z - (int)entry.Radius));
+		maxPos = Vector2i(std::max(maxPos.x, pos.x + (int)entry.Radius), std::max(maxPos.y, pos.z + (int)entry.Radius));
+	}
+
+	SoundSourceGridOrigin = minPos;
+	SoundSourceGridSize = Vector2i(((maxPos.x - minPos.x) / SOUND_SOURCE_CELL_SIZE) + 1, ((maxPos.y - minPos.y) / SOUND_SOURCE_CELL_SIZE) + 1);
+
+	// Count entries per cell, turn counts into offsets, then fill cells.
+	SoundSourceCellOffsets.assign((SoundSourceGridSize.x * SoundSourceGridSize.y) + 1, 0);
+
+	Vector2i minCell, maxCell;
+	for (const auto& entry : sources)
+	{
+		getCellRange(entry, minCell, maxCell);
+		for (int z = minCell.y; z <= maxCell.y; z++)
+		{
+			for (int x = minCell.x; x <= maxCell.x; x++)
+				SoundSourceCellOffsets[(z * SoundSourceGridSize.x) + x + 1]++;
+		}
+	}
+
+	for (int i = 1; i < SoundSourceCellOffsets.size(); i++)
+		SoundSourceCellOffsets[i] += SoundSourceCellOffsets[i - 1];
+
+	auto cellEnds = std::vector<int>(SoundSourceCellOffsets.begin(), SoundSourceCellOffsets.end() - 1);
+	SoundSourceEntries.resize(SoundSourceCellOffsets.back());
+
+	for (const auto& entry : sources)
+	{
+		getCellRange(entry, minCell, maxCell);
+		for (int z = minCell.y; z <= maxCell.y; z++)
+		{
+			for (int x = minCell.x; x <= maxCell.x; x++)
+				SoundSourceEntries[cellEnds[(z * SoundSourceGridSize.x) + x]++] = entry;
+		}
+	}
+}
+
+// Only sources listed in listener's grid cell and within their radius are passed to SoundEffect.
+// Grid is rebuilt lazily after level load or when script changes sound source.
+void PlaySoundSources()
+{
+	if (SoundSourceGridIsDirty)
+		BuildSoundSourceGrid();
+
+	if (SoundSourceEntries.empty())
+		return;
+
+	auto listenerPos = Camera.mikePos;
+	if (listenerPos.x < SoundSourceGridOrigin.x || listenerPos.z < SoundSourceGridOrigin.y)
+		return;
+
+	int cellX = (listenerPos.x - SoundSourceGridOrigin.x) / SOUND_SOURCE_CELL_SIZE;
+	int cellZ = (listenerPos.z - SoundSourceGridOrigin.y) / SOUND_SOURCE_CELL_SIZE;
+	if (cellX >= SoundSourceGridSize.x || cellZ >= SoundSourceGridSize.y)
+		return;
+
+	int cell = (cellZ * SoundSourceGridSize.x) + cellX;
+	for (int i = SoundSourceCellOffsets[cell]; i < SoundSourceCellOffsets[cell + 1]; i++)
+	{
+		const auto& entry = SoundSourceEntries[i];
+
+		if (entry.PlayMode == SoundSourcePlayMode::FlipRoom && !FlipStats[entry.FlipGroup])
+			continue;
+		else if (entry.PlayMode == SoundSourcePlayMode::BaseRoom && FlipStats[entry.FlipGroup])
+			continue;
+
+		auto& sound = g_Level.SoundSources[entry.SourceIndex];
+		if (Vector3i::Distance(listenerPos, sound.Position) > entry.Radius)
 			continue;
 
 		SoundEffect(sound.SoundID, (Pose*)&sound.Position);
@@ -30,6 +30,7 @@ constexpr auto SOUND_XFADETIME_HIJACKSOUND   = 50;
 constexpr auto SOUND_BGM_DAMP_COEFFICIENT    = 0.5f;
 constexpr auto SOUND_MIN_PARAM_MULTIPLIER    = 0.05f;
 constexpr auto SOUND_MAX_PARAM_MULTIPLIER    = 5.0f;
+constexpr auto SOUND_PRIORITY_OMNIPRESENT    = 4.0f;	// Ranking weight of 2D sounds, so menu and voice effects keep their channels
 
 enum class SoundPauseMode
 {
@@ -71,13 +72,6 @@ enum class ReverbType
 	Count
 };
 
-enum class SoundState
-{
-	Idle,
-	Ending,
-	Ended
-};
-
 enum class SoundFilter
 {
 	Reverb,
@@ -86,15 +80,6 @@ enum class SoundFilter
 	Count
 };
 
-struct SoundEffectSlot
-{
-	SoundState State;
-	short EffectID;
-	float Gain;
-	HCHANNEL Channel;
-	Vector3 Origin;
-};
-
 struct SoundTrackSlot
 {
 	HSTREAM Channel { 0 };
@@ -160,6 +145,7 @@ void PauseAllSounds(SoundPauseMode mode);
 void ResumeAllSounds(SoundPauseMode mode);
 void SayNo();
 void PlaySoundSources();
+void InvalidateSoundSources();
 int  GetShatterSound(int shatterID);
 
 void PlaySoundTrack(const std::string& trackName, SoundTrackType mode, QWORD position = 0);
@@ -183,14 +169,15 @@ void  SetVolumeFX(int vol);
 void  Sound_Init(const std::string& gameDirectory);
 void  Sound_DeInit();
 bool  Sound_CheckBASSError(const char* message, bool verbose, ...);
-void  Sound_UpdateScene();
+void  Sound_UpdateScene(float deltaTime);
 void  Sound_FreeSample(int index);
-int   Sound_GetFreeSlot();
 void  Sound_FreeSlot(int index, unsigned int fadeout = 0);
+void  Sound_FreeVoice(int index, unsigned int fadeout = 0);
+bool  Sound_StartVoice(int voiceIndex, int index);
 int   Sound_EffectIsPlaying(int effectID, Pose *position);
 int   Sound_TrackIsPlaying(const std::string& fileName);
 float Sound_DistanceToListener(Pose *position);
 float Sound_DistanceToListener(Vector3 position);
 float Sound_Attenuate(float gain, float distance, float radius);
-bool  Sound_UpdateEffectPosition(int index, Pose *position, bool force = false);
+bool  Sound_UpdateEffectPosition(int index, const Vector3& origin);
 bool  Sound_UpdateEffectAttributes(int index, float pitch, float gain);
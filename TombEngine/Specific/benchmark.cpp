@@ -0,0 +1,113 @@
+#include "framework.h"
+#include "Specific/benchmark.h"
+
+#include "Game/animation.h"
+#include "Game/AnimationCompression.h"
+#include "Game/effects/debris.h"
+#include "Game/effects/HairSolver.h"
+#include "Game/Setup.h"
+#include "Math/Legacy.h"
+#include "Renderer/LightGrid.h"
+#include "Renderer/RoomVisibility.h"
+#include "Renderer/StringLayoutCache.h"
+#include "Renderer/Texture2D/TextureData.h"
+#include "Sound/SoftwareSoundBackend.h"
+#include "Sound/VoiceManager.h"
+#include "Specific/level.h"
+#include "Specific/winmain.h"
+
+using namespace TEN::Animation;
+using namespace TEN::Effects::Hair;
+using namespace TEN::Renderer;
+using namespace TEN::Sound;
+
+struct BenchmarkEntry
+{
+	std::string Name		  = {};
+	bool		RequiresLevel = false;
+	bool		(*Function)() = nullptr;
+};
+
+std::string BenchmarkName = {};
+
+static bool BenchmarkAnimations()
+{
+	// Keyframe reduction is opt-in. Check it with bound given on command line, or with typical one if none was.
+	constexpr auto DEFAULT_MAX_ERROR = 0.25f * RADIAN;
+
+	return BenchmarkAnimationCompression((AnimCompressionMaxError > 0.0f) ? AnimCompressionMaxError : DEFAULT_MAX_ERROR);
+}
+
+static bool BenchmarkTextureDecoding()
+{
+	auto sources = std::vector<TextureSource>{};
+	auto addSource = [&](const std::vector<byte>& data)
+	{
+		if (!data.empty())
+			sources.push_back(TextureSource{ data.data(), (int)data.size() });
+	};
+
+	for (const auto* textures : { &g_Level.AnimatedTextures, &g_Level.RoomTextures, &g_Level.MoveablesTextures, &g_Level.StaticsTextures, &g_Level.SpritesTextures })
+	{
+		for (const auto& texture : *textures)
+		{
+			addSource(texture.colorMapData);
+			addSource(texture.normalMapData);
+		}
+	}
+
+	addSource(g_Level.SkyTexture.colorMapData);
+	return BenchmarkTextureDecodeQueue(sources, TEXTURE_DECODE_QUEUE_SIZE);
+}
+
+static const auto Benchmarks = std::vector<BenchmarkEntry>
+{
+	{ "trig",	  false, BenchmarkLegacyTrig },
+	{ "lights",	  false, BenchmarkLightGrid },
+	{ "dispatch", false, BenchmarkObjectDispatch },
+	{ "pose",	  false, BenchmarkFramePose },
+	{ "anim",	  false, BenchmarkAnimations },
+	{ "hair",	  false, TestHairSolver },
+	{ "voices",	  false, TestVoiceManager },
+	{ "mixer",	  false, TestSoftwareSoundBackend },
+	{ "strings",  false, BenchmarkStringLayouts },
+	{ "textures", true,	 BenchmarkTextureDecoding },
+	{ "rooms",	  true,	 []() { return BenchmarkRoomVisibility(g_Level.Rooms); } },
+	{ "debris",	  true,	 BenchmarkDebris }
+};
+
+static bool IsBenchmarkSelected(const BenchmarkEntry& entry)
+{
+	return (BenchmarkName == "all" || BenchmarkName == entry.Name);
+}
+
+bool IsBenchmarkRequested(bool requiresLevel)
+{
+	for (const auto& entry : Benchmarks)
+	{
+		if (entry.RequiresLevel == requiresLevel && IsBenchmarkSelected(entry))
+			return true;
+	}
+
+	return false;
+}
+
+bool RunBenchmarks(bool isLevelLoaded)
+{
+	bool isPassed = true;
+	for (const auto& entry : Benchmarks)
+	{
+		if (entry.RequiresLevel != isLevelLoaded || !IsBenchmarkSelected(entry))
+			continue;
+
+		TENLog("Running benchmark " + entry.Name + "...", LogLevel::Info);
+
+		if (!entry.Function())
+		{
+			TENLog("Benchmark " + entry.Name + " failed.", LogLevel::Error);
+			isPassed = false;
+		}
+	}
+
+	return isPassed;
+}
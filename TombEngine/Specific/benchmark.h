@@ -0,0 +1,11 @@
+#pragma once
+#include <string>
+
+// Benchmarks and self-checks are run from command line with "-benchmark <name>" or "-benchmark all".
+// Each one logs its own report and returns false if check has failed.
+// Benchmarks which need level run once first level is loaded, others run before game is initialized.
+
+extern std::string BenchmarkName;
+
+bool IsBenchmarkRequested(bool requiresLevel);
+bool RunBenchmarks(bool isLevelLoaded);
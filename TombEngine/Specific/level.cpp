@@ -10,6 +10,7 @@
 #include "Game/control/control.h"
 #include "Game/control/volume.h"
 #include "Game/control/lot.h"
+#include "Game/effects/debris.h"
 #include "Game/items.h"
 #include "Game/Lara/lara.h"
 #include "Game/Lara/lara_initialise.h"
@@ -25,9 +26,11 @@
 #include "Scripting/Include/Objects/ScriptInterfaceObjectsHandler.h"
 #include "Scripting/Include/ScriptInterfaceGame.h"
 #include "Scripting/Include/ScriptInterfaceLevel.h"
+#include "Scripting/Include/ScriptInterfaceState.h"
 #include "Sound/sound.h"
 #include "Specific/Input/Input.h"
 #include "Specific/trutils.h"
+#include "Specific/winmain.h"
 
 using TEN::Renderer::g_Renderer;
 
@@ -39,6 +42,39 @@ std::vector<int> MoveablesIds;
 std::vector<int> StaticObjectsIds;
 LEVEL g_Level;
 
+static size_t SampleDataSize = 0;
+
+// Unlike resize(0) or clear(), also frees vector's capacity.
+template <typename T>
+static void ReleaseVector(std::vector<T>& vector)
+{
+	std::vector<T>().swap(vector);
+}
+
+template <typename T>
+static size_t GetVectorMemorySize(const std::vector<T>& vector)
+{
+	return (vector.capacity() * sizeof(T));
+}
+
+static size_t GetTextureMemorySize(const std::vector<TEXTURE>& textures)
+{
+	size_t size = GetVectorMemorySize(textures);
+	for (const auto& texture : textures)
+		size += GetVectorMemorySize(texture.colorMapData) + GetVectorMemorySize(texture.normalMapData);
+
+	return size;
+}
+
+static size_t GetBucketMemorySize(const std::vector<BUCKET>& buckets)
+{
+	size_t size = GetVectorMemorySize(buckets);
+	for (const auto& bucket : buckets)
+		size += GetVectorMemorySize(bucket.polygons);
+
+	return size;
+}
+
 unsigned char ReadUInt8()
 {
 	unsigned char value = *(unsigned char*)LevelDataPtr;
@@ -159,7 +195,11 @@ void LoadItems()
 	if (g_Level.NumItems == 0)
 		return;
 
-	InitializeItemArray(NUM_ITEMS);
+	if (g_Level.NumItems >= MAX_ITEMS)
+		throw std::exception{ ("Level has too many items. Maximum is " + std::to_string(MAX_ITEMS - 1) + ".").c_str() };
+
+	InitializeItemArray(g_Level.NumItems + NUM_ITEMS);
+	TENLog("Item size: " + std::to_string(sizeof(ItemInfo)) + " bytes, item data size: " + std::to_string(sizeof(ItemData)) + " bytes.", LogLevel::Info, LogConfig::Debug);
 
 	if (g_Level.NumItems > 0)
 	{
@@ -201,6 +241,47 @@ void LoadItems()
 	}
 }
 
+// Polygon vertex attributes are stored as consecutive arrays, so they are read straight into level polygon arena.
+void ReadBucket(BUCKET& bucket, bool hasShineStrength)
+{
+	bucket.texture = ReadInt32();
+	bucket.blendMode = (BLEND_MODES)ReadUInt8();
+	bucket.animated = ReadBool();
+	bucket.numQuads = 0;
+	bucket.numTriangles = 0;
+
+	auto& arena = g_Level.Polygons;
+
+	// Allocate for worst case of all quads once per bucket, and drop unused tail afterwards.
+	int numPolygons = ReadInt32();
+	bucket.polygons.resize(numPolygons);
+	int nextIndex = arena.Allocate(numPolygons * 4);
+
+	for (auto& poly : bucket.polygons)
+	{
+		poly.shape = ReadInt32();
+		poly.animatedSequence = ReadInt32();
+		poly.animatedFrame = ReadInt32();
+		poly.shineStrength = hasShineStrength ? ReadFloat() : 0.0f;
+		poly.vertexCount = (poly.shape == 0) ? 4 : 3;
+		poly.baseIndex = nextIndex;
+		nextIndex += poly.vertexCount;
+
+		ReadBytes(&arena.Indices[poly.baseIndex], sizeof(int) * poly.vertexCount);
+		ReadBytes(&arena.TextureCoordinates[poly.baseIndex], sizeof(Vector2) * poly.vertexCount);
+		ReadBytes(&arena.Normals[poly.baseIndex], sizeof(Vector3) * poly.vertexCount);
+		ReadBytes(&arena.Tangents[poly.baseIndex], sizeof(Vector3) * poly.vertexCount);
+		ReadBytes(&arena.Binormals[poly.baseIndex], sizeof(Vector3) * poly.vertexCount);
+
+		if (poly.shape == 0)
+			bucket.numQuads++;
+		else
+			bucket.numTriangles++;
+	}
+
+	arena.Truncate(nextIndex);
+}
+
 void LoadObjects()
 {
 	Objects.Initialize();
@@ -234,59 +315,16 @@ void LoadObjects()
 
 		mesh.bones.resize(numVertices);
 		ReadBytes(mesh.bones.data(), 4 * numVertices);
+
+		// Vertex count is lower bound of polygon vertex count, since polygons share vertices.
+		g_Level.Polygons.Reserve(g_Level.Polygons.GetSize() + numVertices);
 		
 		int numBuckets = ReadInt32();
 		mesh.buckets.reserve(numBuckets);
 		for (int j = 0; j < numBuckets; j++)
-		{
-			BUCKET bucket;
-
-			bucket.texture = ReadInt32();
-			bucket.blendMode = (BLEND_MODES)ReadUInt8();
-			bucket.animated = ReadBool();
-			bucket.numQuads = 0;
-			bucket.numTriangles = 0;
-
-			int numPolygons = ReadInt32();
-			bucket.polygons.reserve(numPolygons);
-			for (int k = 0; k < numPolygons; k++)
-			{
-				POLYGON poly;
-
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
-				poly.shineStrength = ReadFloat();
-				int count = (poly.shape == 0 ? 4 : 3);
-				poly.indices.resize(count);
-				poly.textureCoordinates.resize(count);
-				poly.normals.resize(count);
-				poly.tangents.resize(count);
-				poly.binormals.resize(count);
-				
-				for (int n = 0; n < count; n++)
-					poly.indices[n] = ReadInt32();
-				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
-				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.binormals[n] = ReadVector3();
-
-				bucket.polygons.push_back(poly);
-
-				if (poly.shape == 0)
-					bucket.numQuads++;
-				else
-					bucket.numTriangles++;
-			}
-
-			mesh.buckets.push_back(bucket);
-		}
+			ReadBucket(mesh.buckets.emplace_back(), true);
 
-		g_Level.Meshes.push_back(mesh);
+		g_Level.Meshes.push_back(std::move(mesh));
 	}
 
 	int numAnimations = ReadInt32();
@@ -330,6 +368,10 @@ void LoadObjects()
 
 	int numFrames = ReadInt32();
 	g_Level.Frames.resize(numFrames);
+	// Orientations are read uncompressed first, as tracks can only be built once all frames are known.
+	auto orientations = std::vector<Quaternion>{};
+	auto frameOrientationIndices = std::vector<int>(numFrames);
+
 	for (int i = 0; i < numFrames; i++)
 	{
 		auto* frame = &g_Level.Frames[i];
@@ -344,18 +386,20 @@ void LoadObjects()
 		// NOTE: Braces are necessary to ensure correct value init order.
 		frame->Offset = Vector3{ (float)ReadInt16(), (float)ReadInt16(), (float)ReadInt16() };
 
+		// Orientations are stored as x, y, z, w floats, same as Quaternion layout.
 		int numAngles = ReadInt16();
-		frame->BoneOrientations.resize(numAngles);
-		for (int j = 0; j < numAngles; j++)
+		frameOrientationIndices[i] = (int)orientations.size();
+		frame->BoneCount = numAngles;
+
+		if (numAngles > 0)
 		{
-			auto* q = &frame->BoneOrientations[j];
-			q->x = ReadFloat();
-			q->y = ReadFloat();
-			q->z = ReadFloat();
-			q->w = ReadFloat();
+			orientations.resize(frameOrientationIndices[i] + numAngles);
+			ReadBytes(&orientations[frameOrientationIndices[i]], sizeof(Quaternion) * numAngles);
 		}
 	}
 
+	CompressAnimations(orientations, frameOrientationIndices, AnimCompressionMaxError, DebugMode);
+
 	int numModels = ReadInt32();
 	TENLog("Num models: " + std::to_string(numModels), LogLevel::Info);
 
@@ -634,55 +678,13 @@ void ReadRooms()
 		for (int j = 0; j < numVertices; j++)
 			room.effects.push_back(ReadVector3());
 
+		// Vertex count is lower bound of polygon vertex count, since polygons share vertices.
+		g_Level.Polygons.Reserve(g_Level.Polygons.GetSize() + numVertices);
+
 		int numBuckets = ReadInt32();
 		room.buckets.reserve(numBuckets);
 		for (int j = 0; j < numBuckets; j++)
-		{
-			BUCKET bucket;
-
-			bucket.texture = ReadInt32();
-			bucket.blendMode = (BLEND_MODES)ReadUInt8();
-			bucket.animated = ReadBool();
-			bucket.numQuads = 0;
-			bucket.numTriangles = 0;
-
-			int numPolygons = ReadInt32();
-			bucket.polygons.reserve(numPolygons);
-			for (int k = 0; k < numPolygons; k++)
-			{
-				POLYGON poly;
-				
-				poly.shape = ReadInt32();
-				poly.animatedSequence = ReadInt32();
-				poly.animatedFrame = ReadInt32();
-				int count = (poly.shape == 0 ? 4 : 3);
-				poly.indices.resize(count);
-				poly.textureCoordinates.resize(count);
-				poly.normals.resize(count);
-				poly.tangents.resize(count);
-				poly.binormals.resize(count);
-
-				for (int n = 0; n < count; n++)
-					poly.indices[n] = ReadInt32();
-				for (int n = 0; n < count; n++)
-					poly.textureCoordinates[n] = ReadVector2();
-				for (int n = 0; n < count; n++)
-					poly.normals[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.tangents[n] = ReadVector3();
-				for (int n = 0; n < count; n++)
-					poly.binormals[n] = ReadVector3();
-
-				bucket.polygons.push_back(poly);
-
-				if (poly.shape == 0)
-					bucket.numQuads++;
-				else
-					bucket.numTriangles++;
-			}
-
-			room.buckets.push_back(bucket);
-		}
+			ReadBucket(room.buckets.emplace_back(), false);
 
 		int numPortals = ReadInt32();
 		for (int j = 0; j < numPortals; j++)
@@ -732,7 +734,7 @@ void ReadRooms()
 			floor.Flags.MarkTriggererActive = 0; // TODO: IT NEEDS TO BE WRITTEN/READ FROM SAVEGAMES!
 			floor.Flags.MarkBeetle = ReadBool();
 
-			floor.Room = i;
+			floor.SourceRoom = i;
 
 			room.floor.push_back(floor);
 		}
@@ -838,11 +840,17 @@ void LoadRooms()
 	Wibble = 0;
 
 	ReadRooms();
-	BuildOutsideRoomsTable();
+	BuildRoomSectorTables();
+
+	g_Level.RoomSlots.resize(g_Level.Rooms.size());
+	for (int i = 0; i < g_Level.RoomSlots.size(); i++)
+		g_Level.RoomSlots[i] = i;
 
+	// Floordata is only needed to build trigger tables, so it's not kept after loading.
 	int numFloorData = ReadInt32(); 
-	g_Level.FloorData.resize(numFloorData);
-	ReadBytes(g_Level.FloorData.data(), numFloorData * sizeof(short));
+	auto floorData = std::vector<short>(numFloorData);
+	ReadBytes(floorData.data(), numFloorData * sizeof(short));
+	CompileTriggers(floorData);
 }
 
 void FreeLevel()
@@ -854,38 +862,42 @@ void FreeLevel()
 		return;
 	}
 
-	g_Level.RoomTextures.resize(0);
-	g_Level.MoveablesTextures.resize(0);
-	g_Level.StaticsTextures.resize(0);
-	g_Level.AnimatedTextures.resize(0);
-	g_Level.SpritesTextures.resize(0);
-	g_Level.AnimatedTexturesSequences.resize(0);
-	g_Level.Rooms.resize(0);
-	g_Level.Bones.resize(0);
-	g_Level.Meshes.resize(0);
-	MoveablesIds.resize(0);
-	g_Level.Boxes.resize(0);
-	g_Level.Overlaps.resize(0);
-	g_Level.Anims.resize(0);
-	g_Level.Changes.resize(0);
-	g_Level.Ranges.resize(0);
-	g_Level.Commands.resize(0);
-	g_Level.Frames.resize(0);
-	g_Level.Sprites.resize(0);
-	g_Level.SoundDetails.resize(0);
-	g_Level.SoundMap.resize(0);
-	g_Level.FloorData.resize(0);
-	g_Level.Cameras.resize(0);
-	g_Level.Sinks.resize(0);
-	g_Level.SoundSources.resize(0);
-	g_Level.AIObjects.resize(0);
-	g_Level.EventSets.resize(0);
-	g_Level.Items.resize(0);
+	ReleaseVector(g_Level.RoomTextures);
+	ReleaseVector(g_Level.MoveablesTextures);
+	ReleaseVector(g_Level.StaticsTextures);
+	ReleaseVector(g_Level.AnimatedTextures);
+	ReleaseVector(g_Level.SpritesTextures);
+	ReleaseVector(g_Level.AnimatedTexturesSequences);
+	ReleaseVector(g_Level.Rooms);
+	ReleaseVector(g_Level.Bones);
+	ReleaseVector(g_Level.Meshes);
+	g_Level.Polygons.Clear();
+	ReleaseVector(MoveablesIds);
+	ReleaseVector(g_Level.Boxes);
+	ReleaseVector(g_Level.Overlaps);
+	ReleaseVector(g_Level.Anims);
+	ReleaseVector(g_Level.Changes);
+	ReleaseVector(g_Level.Ranges);
+	ReleaseVector(g_Level.Commands);
+	ReleaseVector(g_Level.Frames);
+	ReleaseVector(g_Level.AnimTracks);
+	ReleaseVector(g_Level.BoneOrientations);
+	ReleaseVector(g_Level.Sprites);
+	ReleaseVector(g_Level.SoundDetails);
+	ReleaseVector(g_Level.SoundMap);
+	ReleaseVector(g_Level.Triggers);
+	ReleaseVector(g_Level.TriggerActions);
+	ReleaseVector(g_Level.Cameras);
+	ReleaseVector(g_Level.Sinks);
+	ReleaseVector(g_Level.SoundSources);
+	ReleaseVector(g_Level.AIObjects);
+	ReleaseVector(g_Level.EventSets);
+	ReleaseVector(g_Level.Items);
 
 	for (int i = 0; i < 2; i++)
 	{
 		for (int j = 0; j < (int)ZoneType::MaxZone; j++)
-			g_Level.Zones[j][i].clear();
+			ReleaseVector(g_Level.Zones[j][i]);
 	}
 
 	g_Renderer.FreeRendererData();
@@ -893,6 +905,7 @@ void FreeLevel()
 	g_GameScriptEntities->FreeEntities();
 
 	FreeSamples();
+	ClearShatterTemplates();
 }
 
 size_t ReadFileEx(void* ptr, size_t size, size_t count, FILE* stream)
@@ -922,6 +935,8 @@ void LoadSoundSources()
 
 		g_GameScriptEntities->AddName(source.Name, source);
 	}
+
+	InvalidateSoundSources();
 }
 
 void LoadAnimatedTextures()
@@ -1041,6 +1056,108 @@ bool Decompress(byte* dest, byte* src, unsigned long compressedSize, unsigned lo
 	return false;
 }
 
+// Called once renderer has built its resources. Frees CPU-side data which only renderer consumes.
+void ReleaseRendererData()
+{
+	ReleaseVector(g_Level.RoomTextures);
+	ReleaseVector(g_Level.MoveablesTextures);
+	ReleaseVector(g_Level.StaticsTextures);
+	ReleaseVector(g_Level.AnimatedTextures);
+	ReleaseVector(g_Level.SpritesTextures);
+	ReleaseVector(g_Level.SkyTexture.colorMapData);
+	ReleaseVector(g_Level.SkyTexture.normalMapData);
+
+	// Room doors and sectors are still used by game logic.
+	for (auto& room : g_Level.Rooms)
+	{
+		ReleaseVector(room.positions);
+		ReleaseVector(room.normals);
+		ReleaseVector(room.colors);
+		ReleaseVector(room.effects);
+		ReleaseVector(room.buckets);
+	}
+
+	// Shatter debris reads mesh positions, colors and polygons, so only keep these.
+	// Polygon arena is repacked with mesh polygons only, without tangents and binormals.
+	int numVertices = 0;
+	for (auto& mesh : g_Level.Meshes)
+	{
+		ReleaseVector(mesh.normals);
+		ReleaseVector(mesh.effects);
+		ReleaseVector(mesh.bones);
+
+		for (const auto& bucket : mesh.buckets)
+			numVertices += (bucket.numQuads * 4) + (bucket.numTriangles * 3);
+	}
+
+	const auto& oldArena = g_Level.Polygons;
+	auto arena = PolygonArena{};
+	arena.Indices.reserve(numVertices);
+	arena.TextureCoordinates.reserve(numVertices);
+	arena.Normals.reserve(numVertices);
+
+	for (auto& mesh : g_Level.Meshes)
+	{
+		for (auto& bucket : mesh.buckets)
+		{
+			for (auto& poly : bucket.polygons)
+			{
+				int baseIndex = (int)arena.Indices.size();
+				int first = poly.baseIndex;
+				int last = poly.baseIndex + poly.vertexCount;
+
+				arena.Indices.insert(arena.Indices.end(), oldArena.Indices.begin() + first, oldArena.Indices.begin() + last);
+				arena.TextureCoordinates.insert(arena.TextureCoordinates.end(), oldArena.TextureCoordinates.begin() + first, oldArena.TextureCoordinates.begin() + last);
+				arena.Normals.insert(arena.Normals.end(), oldArena.Normals.begin() + first, oldArena.Normals.begin() + last);
+
+				poly.baseIndex = baseIndex;
+			}
+		}
+	}
+
+	g_Level.Polygons = std::move(arena);
+}
+
+void LogLevelMemoryUsage()
+{
+	size_t textureSize = GetTextureMemorySize(g_Level.RoomTextures) + GetTextureMemorySize(g_Level.MoveablesTextures) +
+		GetTextureMemorySize(g_Level.StaticsTextures) + GetTextureMemorySize(g_Level.AnimatedTextures) +
+		GetTextureMemorySize(g_Level.SpritesTextures) +
+		GetVectorMemorySize(g_Level.SkyTexture.colorMapData) + GetVectorMemorySize(g_Level.SkyTexture.normalMapData);
+
+	size_t geometrySize = g_Level.Polygons.GetMemorySize() + GetVectorMemorySize(g_Level.Meshes);
+	for (const auto& mesh : g_Level.Meshes)
+	{
+		geometrySize += GetVectorMemorySize(mesh.positions) + GetVectorMemorySize(mesh.normals) + GetVectorMemorySize(mesh.colors) +
+			GetVectorMemorySize(mesh.effects) + GetVectorMemorySize(mesh.bones) + GetBucketMemorySize(mesh.buckets);
+	}
+
+	size_t floordataSize = GetVectorMemorySize(g_Level.Triggers) + GetVectorMemorySize(g_Level.TriggerActions) + GetVectorMemorySize(g_Level.Rooms);
+	for (const auto& room : g_Level.Rooms)
+	{
+		geometrySize += GetVectorMemorySize(room.positions) + GetVectorMemorySize(room.normals) + GetVectorMemorySize(room.colors) +
+			GetVectorMemorySize(room.effects) + GetBucketMemorySize(room.buckets) + GetVectorMemorySize(room.doors);
+		floordataSize += GetVectorMemorySize(room.floor);
+	}
+
+	size_t animationSize = GetVectorMemorySize(g_Level.Anims) + GetVectorMemorySize(g_Level.Frames) + GetVectorMemorySize(g_Level.AnimTracks) +
+		GetVectorMemorySize(g_Level.BoneOrientations) +
+		GetVectorMemorySize(g_Level.Changes) + GetVectorMemorySize(g_Level.Ranges) + GetVectorMemorySize(g_Level.Commands);
+
+	size_t itemSize = GetVectorMemorySize(g_Level.Items);
+	size_t scriptSize = ScriptInterfaceState::GetMemoryUsage();
+
+	auto toKilobytes = [](size_t size) { return std::to_string(size / 1024) + " KB"; };
+
+	TENLog("Level memory usage: textures " + toKilobytes(textureSize) +
+		", geometry " + toKilobytes(geometrySize) +
+		", floordata " + toKilobytes(floordataSize) +
+		", animations " + toKilobytes(animationSize) +
+		", items " + toKilobytes(itemSize) +
+		", samples " + toKilobytes(SampleDataSize) +
+		", script " + toKilobytes(scriptSize) + ".", LogLevel::Info);
+}
+
 bool LoadLevel(int levelIndex)
 {
 	auto* level = g_GameFlow->GetLevel(levelIndex);
@@ -1130,6 +1247,8 @@ bool LoadLevel(int levelIndex)
 		g_Renderer.UpdateProgress(40);
 
 		LoadObjects();
+		TENLog("Polygon arena: " + std::to_string(g_Level.Polygons.Indices.size()) + " vertices, " +
+			std::to_string(g_Level.Polygons.GetMemorySize() / 1024) + " KB.", LogLevel::Info, LogConfig::Debug);
 		g_Renderer.UpdateProgress(50);
 
 		LoadSprites();
@@ -1166,6 +1285,8 @@ bool LoadLevel(int levelIndex)
 		TENLog("Preparing renderer...", LogLevel::Info);
 
 		g_Renderer.PrepareDataForTheRenderer();
+		ReleaseRendererData();
+		LogLevelMemoryUsage();
 
 		TENLog("Level loading complete.", LogLevel::Info);
 
@@ -1200,6 +1321,8 @@ void LoadSamples()
 {
 	TENLog("Loading samples... ", LogLevel::Info);
 
+	SampleDataSize = 0;
+
 	int soundMapSize = ReadInt16();
 	TENLog("Sound map size: " + std::to_string(soundMapSize), LogLevel::Info);
 
@@ -1234,6 +1357,8 @@ void LoadSamples()
 		compressedSize = ReadInt32();
 		ReadBytes(buffer, compressedSize);
 		LoadSample(buffer, compressedSize, uncompressedSize, i);
+
+		SampleDataSize += uncompressedSize;
 	}
 
 	free(buffer);
@@ -1402,37 +1527,6 @@ void GetAIPickups()
 	}
 }
 
-void BuildOutsideRoomsTable()
-{
-	for (int x = 0; x < OUTSIDE_SIZE; x++)
-	{
-		for (int z = 0; z < OUTSIDE_SIZE; z++)
-			OutsideRoomTable[x][z].clear();
-	}
-
-	for (int i = 0; i < g_Level.Rooms.size(); i++)
-	{
-		auto* room = &g_Level.Rooms[i];
-
-		int rx = (room->x / BLOCK(1));
-		int rz = (room->z / BLOCK(1));
-
-		for (int x = 0; x < OUTSIDE_SIZE; x++)
-		{
-			if (x < (rx + 1) || x > (rx + room->xSize - 2))
-				continue;
-
-			for (int z = 0; z < OUTSIDE_SIZE; z++)
-			{
-				if (z < (rz + 1) || z > (rz + room->zSize - 2))
-					continue;
-
-				OutsideRoomTable[x][z].push_back(i);
-			}
-		}
-	}
-}
-
 void LoadPortal(ROOM_INFO& room) 
 {
 	ROOM_DOOR door;
@@ -1,5 +1,7 @@
 #pragma once
 #include "Game/animation.h"
+#include "Game/AnimationCompression.h"
+#include "Game/control/trigger.h"
 #include "Game/control/volumeactivator.h"
 #include "Game/items.h"
 #include "Game/itemdata/creature_info.h"
@@ -12,6 +14,7 @@
 #include "Specific/LevelCameraInfo.h"
 #include "Specific/newtypes.h"
 
+using namespace TEN::Animation;
 using namespace TEN::Control::Volumes;
 
 struct ChunkId;
@@ -96,18 +99,23 @@ struct LEVEL
 	std::vector<ItemInfo> Items	   = {};
 	std::vector<MESH>	  Meshes   = {};
 	std::vector<int>	  Bones	   = {};
+	PolygonArena		  Polygons = {}; // Vertex attributes of room and mesh polygons.
 
 	// Animation data
-	std::vector<AnimData>				Anims	 = {};
-	std::vector<AnimFrame>				Frames	 = {};
-	std::vector<StateDispatchData>		Changes	 = {};
-	std::vector<StateDispatchRangeData> Ranges	 = {};
-	std::vector<short>					Commands = {};
+	std::vector<AnimData>				Anims			 = {};
+	std::vector<AnimFrame>				Frames			 = {};
+	std::vector<AnimTrack>				AnimTracks		 = {};
+	std::vector<PackedQuaternion>		BoneOrientations = {}; // Compressed keyframe bone orientations, stored contiguously per track.
+	std::vector<StateDispatchData>		Changes			 = {};
+	std::vector<StateDispatchRangeData> Ranges			 = {};
+	std::vector<short>					Commands		 = {};
 
 	// Collision data
-	std::vector<ROOM_INFO> Rooms	 = {};
-	std::vector<short>	   FloorData = {};
-	std::vector<SinkInfo>  Sinks	 = {};
+	std::vector<ROOM_INFO>	   Rooms		  = {};
+	std::vector<int>		   RoomSlots	  = {}; // Current room number of room data loaded at given index. Changed by flipmaps.
+	std::vector<TriggerInfo>   Triggers		  = {}; // Indexed by FloorInfo::TriggerIndex.
+	std::vector<TriggerAction> TriggerActions = {};
+	std::vector<SinkInfo>	   Sinks		  = {};
 
 	// Pathfinding data
 	std::vector<BOX_INFO> Boxes	   = {};
@@ -148,6 +156,8 @@ bool Decompress(byte* dest, byte* src, unsigned long compressedSize, unsigned lo
 
 bool LoadLevelFile(int levelIndex);
 void FreeLevel();
+void ReleaseRendererData();
+void LogLevelMemoryUsage();
 
 void LoadTextures();
 void LoadRooms();
@@ -162,7 +172,7 @@ void LoadAnimatedTextures();
 void LoadAIObjects();
 
 void LoadPortal(ROOM_INFO& room);
+void ReadBucket(BUCKET& bucket, bool hasShineStrength);
 
 void GetCarriedItems();
 void GetAIPickups();
-void BuildOutsideRoomsTable();
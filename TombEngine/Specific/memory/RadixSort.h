@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace TEN::Memory
+{
+	struct SortKey
+	{
+		uint64_t Key   = 0;
+		int		 Index = 0;
+	};
+
+	// Stable LSD radix sort on 8-bit digits, ascending by key. Digits which are equal for all keys are skipped,
+	// so keys which differ only in few bytes need only few passes. Scratch is kept by caller to avoid reallocations.
+	inline void RadixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch)
+	{
+		constexpr auto DIGIT_BITS	= 8;
+		constexpr auto DIGIT_COUNT	= 64 / DIGIT_BITS;
+		constexpr auto BUCKET_COUNT = 1 << DIGIT_BITS;
+		constexpr auto DIGIT_MASK	= (uint64_t)(BUCKET_COUNT - 1);
+
+		size_t count = keys.size();
+		if (count < 2)
+			return;
+
+		scratch.resize(count);
+
+		// Digit counts don't depend on order, so all histograms are built in single pass.
+		auto histograms = std::array<std::array<size_t, BUCKET_COUNT>, DIGIT_COUNT>{};
+		for (const auto& key : keys)
+		{
+			for (int digit = 0; digit < DIGIT_COUNT; digit++)
+				histograms[digit][(key.Key >> (digit * DIGIT_BITS)) & DIGIT_MASK]++;
+		}
+
+		auto* src = &keys;
+		auto* dst = &scratch;
+
+		for (int digit = 0; digit < DIGIT_COUNT; digit++)
+		{
+			int shift = digit * DIGIT_BITS;
+			auto& histogram = histograms[digit];
+
+			if (histogram[(src->front().Key >> shift) & DIGIT_MASK] == count)
+				continue;
+
+			size_t offset = 0;
+			for (auto& bucket : histogram)
+			{
+				size_t bucketSize = bucket;
+				bucket = offset;
+				offset += bucketSize;
+			}
+
+			for (const auto& key : *src)
+				(*dst)[histogram[(key.Key >> shift) & DIGIT_MASK]++] = key;
+
+			std::swap(src, dst);
+		}
+
+		if (src != &keys)
+			keys.swap(scratch);
+	}
+}
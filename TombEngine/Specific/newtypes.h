@@ -8,17 +8,84 @@ struct ROOM_VECTOR
 	int yNumber;
 };
 
+// Per-vertex polygon attributes of whole level, stored in flat arrays.
+// Each polygon references its vertices as a contiguous range starting at POLYGON::baseIndex.
+// After renderer upload, only mesh polygons without tangents and binormals are kept (see ReleaseRendererData()).
+struct PolygonArena
+{
+	std::vector<int>	 Indices			= {};
+	std::vector<Vector2> TextureCoordinates = {};
+	std::vector<Vector3> Normals			= {};
+	std::vector<Vector3> Tangents			= {};
+	std::vector<Vector3> Binormals			= {};
+
+	int GetSize() const
+	{
+		return (int)Indices.size();
+	}
+
+	// Grows geometrically, so that reserving per room or mesh doesn't reallocate every time.
+	void Reserve(int count)
+	{
+		if (count <= (int)Indices.capacity())
+			return;
+
+		count = std::max(count, (int)Indices.capacity() * 2);
+		Indices.reserve(count);
+		TextureCoordinates.reserve(count);
+		Normals.reserve(count);
+		Tangents.reserve(count);
+		Binormals.reserve(count);
+	}
+
+	int Allocate(int count)
+	{
+		int baseIndex = (int)Indices.size();
+		int newSize = baseIndex + count;
+
+		Indices.resize(newSize);
+		TextureCoordinates.resize(newSize);
+		Normals.resize(newSize);
+		Tangents.resize(newSize);
+		Binormals.resize(newSize);
+
+		return baseIndex;
+	}
+
+	// Drops unused tail of last allocation. Capacity is kept.
+	void Truncate(int size)
+	{
+		Indices.resize(size);
+		TextureCoordinates.resize(size);
+		Normals.resize(size);
+		Tangents.resize(size);
+		Binormals.resize(size);
+	}
+
+	void Clear()
+	{
+		Indices = {};
+		TextureCoordinates = {};
+		Normals = {};
+		Tangents = {};
+		Binormals = {};
+	}
+
+	size_t GetMemorySize() const
+	{
+		return (Indices.capacity() * sizeof(int)) + (TextureCoordinates.capacity() * sizeof(Vector2)) +
+			((Normals.capacity() + Tangents.capacity() + Binormals.capacity()) * sizeof(Vector3));
+	}
+};
+
 struct POLYGON
 {
 	int shape;
 	int animatedSequence;
 	int animatedFrame;
 	float shineStrength;
-	std::vector<int> indices;
-	std::vector<Vector2> textureCoordinates;
-	std::vector<Vector3> normals;
-	std::vector<Vector3> tangents;
-	std::vector<Vector3> binormals;
+	int baseIndex;	 // First vertex in level polygon arena.
+	int vertexCount;
 };
 
 struct BUCKET
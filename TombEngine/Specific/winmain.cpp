@@ -12,6 +12,7 @@
 #include "Game/savegame.h"
 #include "Renderer/Renderer11.h"
 #include "Sound/sound.h"
+#include "Specific/benchmark.h"
 #include "Specific/level.h"
 #include "Specific/configuration.h"
 #include "Specific/trutils.h"
@@ -33,6 +34,8 @@ unsigned int ThreadID;
 uintptr_t ThreadHandle;
 HACCEL hAccTable;
 bool DebugMode = false;
+bool HeadlessAudioMode = false;
+float AnimCompressionMaxError = 0.0f;
 HWND WindowsHandle;
 DWORD MainThreadID;
 
@@ -260,6 +263,18 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		{
 			DebugMode = true;
 		}
+		else if (ArgEquals(argv[i], "headlessaudio"))
+		{
+			HeadlessAudioMode = true;
+		}
+		else if (ArgEquals(argv[i], "animerror") && argc > (i + 1))
+		{
+			AnimCompressionMaxError = std::max(std::stof(std::wstring(argv[i + 1])), 0.0f) * RADIAN;
+		}
+		else if (ArgEquals(argv[i], "benchmark") && argc > (i + 1))
+		{
+			BenchmarkName = TEN::Utils::ToLower(TEN::Utils::ToString(argv[i + 1]));
+		}
 		else if (ArgEquals(argv[i], "level") && argc > (i + 1))
 		{
 			levelFile = TEN::Utils::ToString(argv[i + 1]);
@@ -304,6 +319,17 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 					   );
 	TENLog(windowName, LogLevel::Info);
 
+	// Run benchmarks which don't need level and quit, unless level benchmarks were requested too.
+	if (!BenchmarkName.empty())
+	{
+		bool isPassed = RunBenchmarks(false);
+		if (!IsBenchmarkRequested(true))
+		{
+			ShutdownTENLog();
+			return (isPassed ? EXIT_SUCCESS : EXIT_FAILURE);
+		}
+	}
+
 	// Initialize savegame and scripting systems.
 	SaveGame::Init(gameDir);
 	ScriptInterfaceState::Init(gameDir);
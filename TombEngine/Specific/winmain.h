@@ -25,6 +25,8 @@ struct WINAPP
 };
 
 extern bool DebugMode;
+extern bool HeadlessAudioMode;
+extern float AnimCompressionMaxError; // Keyframe reduction error bound in radians. 0 keeps every keyframe and only quantizes.
 extern HWND WindowsHandle;
 
 // return handle